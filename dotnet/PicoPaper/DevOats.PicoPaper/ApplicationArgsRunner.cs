@@ -70,6 +70,23 @@ namespace DevOats.PicoPaper
         }
 
 
+        [ArgActionMethod]
+        [ArgDescription("Uploads a bitmap in grayscale to the PicoPaper device, which dithers and displays it")]
+        [ArgShortcut("-g")]
+        public void DisplayDitheredBitmap(
+            [ArgRequired] [ArgDescription("The name of the serial port (e.g. com4)")] string port,
+            [ArgRequired] [ArgDescription("The path to the bitmap file")] string bitmapPath,
+            [ArgDefaultValue(DitherModes.FloydSteinberg)] [ArgDescription("FloydSteinberg, Atkinson or Bayer")] DitherModes mode)
+        {
+            PrintSplashScreen("Uploading image to dither");
+            PicoPaperDevice device = ConnectToPicoPaper(port);
+            Bitmap bmp = new(bitmapPath);
+            device.DisplayBitmapDithered(bmp, mode);
+            Disconnect(device);
+            Console.WriteLine("Done");
+        }
+
+
         private PicoPaperDevice ConnectToPicoPaper(string comPort)
         {
             PicoPaperDevice picoPaper = new PicoPaperDevice();
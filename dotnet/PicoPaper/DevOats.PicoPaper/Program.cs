@@ -81,6 +81,7 @@ namespace DevOats.PicoPaperCmd
                 Console.WriteLine(" c  -  Clear Display");
                 Console.WriteLine(" s  -  Show Splash screen");
                 Console.WriteLine(" d  -  Transmit and display test image");
+                Console.WriteLine(" t  -  Panel status and temperature");
                 Console.WriteLine(" r  -  Reset communication protocol");
                 Console.WriteLine();
                 Console.WriteLine();
@@ -103,6 +104,11 @@ namespace DevOats.PicoPaperCmd
                     case 'd':
                         paper.DisplayBitmap(CreateTestBitmap());
                         break;
+                    case 't':
+                        PicoPaperStatus status = paper.GetStatus();
+                        Console.WriteLine();
+                        Console.WriteLine($"Panel {status.Panel}: {status.Temperature} C, {status.Mode} refresh, about {status.RefreshMs} ms");
+                        break;
                     case 'r':
                         paper.ResetCommProtocol();
                         break;
@@ -124,6 +130,8 @@ namespace DevOats.PicoPaperCmd
             Console.WriteLine($"   Version:   {info.Version}   ");
             Console.WriteLine($"   Board:     {info.Board}     ");
             Console.WriteLine($"   ID:        {info.Id}   ");
+            Console.WriteLine($"   Panels:    {info.Panels}   ");
+            Console.WriteLine($"   Temp:      {(info.Temperature.HasValue ? $"{info.Temperature} C" : "unknown")}   ");
             Console.WriteLine($"   Display:                    ");
             Console.WriteLine($"              Type:        {info.Display.Type}");
             Console.WriteLine($"              Size:        {info.Display.Size}");
@@ -0,0 +1,36 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// The fonts on the device, named by their height in pixels
+    /// </summary>
+    public enum DisplayFonts : byte
+    {
+        Font8 = 0,
+        Font12 = 1,
+        Font16 = 2,
+        Font20 = 3,
+        Font24 = 4,
+
+        /// <summary>
+        /// Proportional versions of the fonts, each character as wide as its ink
+        /// </summary>
+        Font8Proportional = 5,
+        Font12Proportional = 6,
+        Font16Proportional = 7,
+        Font20Proportional = 8,
+        Font24Proportional = 9,
+
+        /// <summary>
+        /// Anti-aliased proportional fonts, edges in gray on a 4 gray image
+        /// </summary>
+        Font8AntiAliased = 10,
+        Font10AntiAliased = 11,
+        Font12AntiAliased = 12
+    }
+}
@@ -0,0 +1,456 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Drawing;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// Builds a display list: drawing ops that the device renders into the image buffer of the selected panel.
+    /// A list of a few hundred bytes replaces the 48 KB of a frame
+    /// </summary>
+    public class DisplayListBuilder
+    {
+        /// <summary>
+        /// Longest list the device accepts
+        /// </summary>
+        public const int MaxLength = 4096;
+
+        /// <summary>
+        /// Number of bitmap slots on the device
+        /// </summary>
+        public const int SlotCount = 16;
+
+        /// <summary>
+        /// Bytes of bitmaps all slots together can hold
+        /// </summary>
+        public const int SlotMemory = 8192;
+
+        /// <summary>
+        /// Largest scale of <see cref="Text"/> and <see cref="Number"/>
+        /// </summary>
+        public const int MaxTextScale = 8;
+
+        /// <summary>
+        /// Longest payload of <see cref="Code128"/>
+        /// </summary>
+        public const int MaxCode128Length = 80;
+
+        /// <summary>
+        /// Most clips the device keeps pushed at the same time
+        /// </summary>
+        public const int MaxClipDepth = 8;
+
+        private const byte OpClear = 0x01;
+        private const byte OpRectangle = 0x02;
+        private const byte OpLine = 0x03;
+        private const byte OpCircle = 0x04;
+        private const byte OpText = 0x05;
+        private const byte OpNumber = 0x06;
+        private const byte OpLoadSlot = 0x07;
+        private const byte OpBlit = 0x08;
+        private const byte OpPushClip = 0x09;
+        private const byte OpPopClip = 0x0A;
+        private const byte OpRoundedRectangle = 0x0B;
+        private const byte OpResetSlots = 0x0C;
+        private const byte OpQrCode = 0x0D;
+        private const byte OpCode128 = 0x0E;
+
+        // Bytes a QR code of the largest version the device makes holds, by error correction level
+        private static readonly int[] QrCapacity = { 271, 213, 151, 119 };
+
+        private readonly List<byte> list = new();
+        private int clipDepth = 0;
+
+
+        /// <summary>
+        /// Gets the length of the list in bytes
+        /// </summary>
+        public int Length
+        {
+            get
+            {
+                return list.Count;
+            }
+        }
+
+
+        /// <summary>
+        /// Fills the whole image with a color
+        /// </summary>
+        public DisplayListBuilder Clear(DrawColors color)
+        {
+            list.Add(OpClear);
+            list.Add((byte)color);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a rectangle between two corners
+        /// </summary>
+        /// <param name="lineWidth">Line width in pixels, 1 to 8</param>
+        public DisplayListBuilder Rectangle(int x0, int y0, int x1, int y1, DrawColors color, int lineWidth = 1, bool filled = false)
+        {
+            list.Add(OpRectangle);
+            AddPoint(x0, y0);
+            AddPoint(x1, y1);
+            AddStroke(color, lineWidth, filled);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a rectangle with corners rounded by the radius
+        /// </summary>
+        /// <param name="lineWidth">Line width in pixels, 1 to 8</param>
+        public DisplayListBuilder RoundedRectangle(int x0, int y0, int x1, int y1, int radius, DrawColors color, int lineWidth = 1, bool filled = false)
+        {
+            list.Add(OpRoundedRectangle);
+            AddPoint(x0, y0);
+            AddPoint(x1, y1);
+            AddWord(radius, nameof(radius));
+            AddStroke(color, lineWidth, filled);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a line between two points
+        /// </summary>
+        /// <param name="lineWidth">Line width in pixels, 1 to 8</param>
+        public DisplayListBuilder Line(int x0, int y0, int x1, int y1, DrawColors color, int lineWidth = 1, bool dotted = false)
+        {
+            list.Add(OpLine);
+            AddPoint(x0, y0);
+            AddPoint(x1, y1);
+            AddStroke(color, lineWidth, dotted);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a circle around a center
+        /// </summary>
+        /// <param name="lineWidth">Line width in pixels, 1 to 8</param>
+        public DisplayListBuilder Circle(int x, int y, int radius, DrawColors color, int lineWidth = 1, bool filled = false)
+        {
+            list.Add(OpCircle);
+            AddPoint(x, y);
+            AddWord(radius, nameof(radius));
+            AddStroke(color, lineWidth, filled);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws printable ASCII text, wrapping at the right edge of the image
+        /// </summary>
+        /// <param name="scale">Every pixel of the font as a square of scale x scale pixels, 1 to <see cref="MaxTextScale"/>. Only for the fixed width fonts</param>
+        public DisplayListBuilder Text(int x, int y, string text, DisplayFonts font, DrawColors foreground = DrawColors.Black, DrawColors background = DrawColors.White, int scale = 1)
+        {
+            if (text.Length > byte.MaxValue)
+            {
+                throw new ArgumentException($"Text is longer than {byte.MaxValue} characters", nameof(text));
+            }
+            if (text.Any(c => c < ' ' || c > '~'))
+            {
+                throw new ArgumentException("Text can only hold printable ASCII characters", nameof(text));
+            }
+
+            list.Add(OpText);
+            AddPoint(x, y);
+            AddFont(font, scale);
+            list.Add((byte)foreground);
+            list.Add((byte)background);
+            list.Add((byte)text.Length);
+            list.AddRange(Encoding.ASCII.GetBytes(text));
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a number in decimal
+        /// </summary>
+        /// <param name="scale">Every pixel of the font as a square of scale x scale pixels, 1 to <see cref="MaxTextScale"/>. Only for the fixed width fonts</param>
+        public DisplayListBuilder Number(int x, int y, int value, DisplayFonts font, DrawColors foreground = DrawColors.Black, DrawColors background = DrawColors.White, int scale = 1)
+        {
+            list.Add(OpNumber);
+            AddPoint(x, y);
+            AddFont(font, scale);
+            list.Add((byte)foreground);
+            list.Add((byte)background);
+            list.Add((byte)value);
+            list.Add((byte)(value >> 8));
+            list.Add((byte)(value >> 16));
+            list.Add((byte)(value >> 24));
+            return this;
+        }
+
+
+        /// <summary>
+        /// Stores a bitmap in a slot of the device for <see cref="Blit"/>. Slots keep their bitmap between lists
+        /// </summary>
+        /// <param name="slot">The slot, 0 to <see cref="SlotCount"/> - 1</param>
+        /// <param name="bitmap">The bitmap. Pixels that are not white are the foreground</param>
+        public DisplayListBuilder LoadSlot(int slot, Bitmap bitmap)
+        {
+            int rowBytes = (bitmap.Width + 7) / 8;
+            byte[] bits = new byte[rowBytes * bitmap.Height];
+
+            for (int y = 0; y < bitmap.Height; y++)
+            {
+                for (int x = 0; x < bitmap.Width; x++)
+                {
+                    Color pixel = bitmap.GetPixel(x, y);
+                    if ((pixel.R != Color.White.R) || (pixel.G != Color.White.G) || (pixel.B != Color.White.B))
+                    {
+                        bits[y * rowBytes + x / 8] |= (byte)(0x80 >> (x % 8));
+                    }
+                }
+            }
+            return LoadSlot(slot, bitmap.Width, bitmap.Height, bits);
+        }
+
+
+        /// <summary>
+        /// Stores a bitmap in a slot of the device for <see cref="Blit"/>. Slots keep their bitmap between lists
+        /// </summary>
+        /// <param name="slot">The slot, 0 to <see cref="SlotCount"/> - 1</param>
+        /// <param name="bits">Rows of (width + 7) / 8 bytes, the most significant bit first. A set bit is the foreground</param>
+        public DisplayListBuilder LoadSlot(int slot, int width, int height, byte[] bits)
+        {
+            if ((slot < 0) || (slot >= SlotCount))
+            {
+                throw new ArgumentOutOfRangeException(nameof(slot), "Invalid slot");
+            }
+            if ((width <= 0) || (height <= 0) || (bits.Length != (width + 7) / 8 * height))
+            {
+                throw new ArgumentException("The bits do not match the bitmap size", nameof(bits));
+            }
+            if (bits.Length > SlotMemory)
+            {
+                throw new ArgumentException("The bitmap does not fit in the slot memory", nameof(bits));
+            }
+
+            list.Add(OpLoadSlot);
+            list.Add((byte)slot);
+            AddWord(width, nameof(width));
+            AddWord(height, nameof(height));
+            list.AddRange(bits);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws the bitmap of a slot with its top left corner at x, y
+        /// </summary>
+        /// <param name="transparent">When true, only the foreground pixels are drawn</param>
+        public DisplayListBuilder Blit(int slot, int x, int y, DrawColors foreground = DrawColors.Black, DrawColors background = DrawColors.White, bool transparent = false)
+        {
+            if ((slot < 0) || (slot >= SlotCount))
+            {
+                throw new ArgumentOutOfRangeException(nameof(slot), "Invalid slot");
+            }
+
+            list.Add(OpBlit);
+            list.Add((byte)slot);
+            AddPoint(x, y);
+            list.Add((byte)foreground);
+            list.Add((byte)background);
+            list.Add((byte)(transparent ? 1 : 0));
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a QR code that the device generates from the payload. The symbol is drawn with its quiet zone of 4 modules,
+        /// so one drawn at the same place replaces it and a partial refresh only sends the symbol
+        /// </summary>
+        /// <param name="x">Left of the quiet zone</param>
+        /// <param name="y">Top of the quiet zone</param>
+        /// <param name="data">The payload, up to 271 bytes at <see cref="QrErrorCorrection.Low"/> and 119 at <see cref="QrErrorCorrection.High"/></param>
+        /// <param name="moduleSize">Pixels per side of a module</param>
+        public DisplayListBuilder QrCode(int x, int y, byte[] data, QrErrorCorrection errorCorrection = QrErrorCorrection.Medium, int moduleSize = 4, DrawColors foreground = DrawColors.Black, DrawColors background = DrawColors.White)
+        {
+            if (data.Length > QrCapacity[(int)errorCorrection])
+            {
+                throw new ArgumentException($"A QR code holds at most {QrCapacity[(int)errorCorrection]} bytes at this error correction level", nameof(data));
+            }
+
+            list.Add(OpQrCode);
+            AddPoint(x, y);
+            AddModuleSize(moduleSize);
+            list.Add((byte)errorCorrection);
+            list.Add((byte)foreground);
+            list.Add((byte)background);
+            AddWord(data.Length, nameof(data));
+            list.AddRange(data);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Draws a QR code of a text, encoded in UTF-8 (see <see cref="QrCode(int, int, byte[], QrErrorCorrection, int, DrawColors, DrawColors)"/>)
+        /// </summary>
+        public DisplayListBuilder QrCode(int x, int y, string text, QrErrorCorrection errorCorrection = QrErrorCorrection.Medium, int moduleSize = 4, DrawColors foreground = DrawColors.Black, DrawColors background = DrawColors.White)
+        {
+            return QrCode(x, y, Encoding.UTF8.GetBytes(text), errorCorrection, moduleSize, foreground, background);
+        }
+
+
+        /// <summary>
+        /// Draws a Code128 barcode that the device generates from the text. The symbol is drawn with its quiet zones
+        /// of 10 modules left and right
+        /// </summary>
+        /// <param name="x">Left of the quiet zone</param>
+        /// <param name="y">Top of the bars</param>
+        /// <param name="text">ASCII, up to <see cref="MaxCode128Length"/> characters</param>
+        /// <param name="height">Pixels per bar</param>
+        /// <param name="moduleSize">Pixels per module, the width of the narrowest bar</param>
+        public DisplayListBuilder Code128(int x, int y, string text, int height, int moduleSize = 2, DrawColors foreground = DrawColors.Black, DrawColors background = DrawColors.White)
+        {
+            if ((text.Length == 0) || (text.Length > MaxCode128Length))
+            {
+                throw new ArgumentException($"A Code128 barcode holds 1 to {MaxCode128Length} characters", nameof(text));
+            }
+            if (text.Any(c => c > 127))
+            {
+                throw new ArgumentException("Code128 can only hold ASCII characters", nameof(text));
+            }
+            if (height < 1)
+            {
+                throw new ArgumentOutOfRangeException(nameof(height), "The bars are at least 1 pixel high");
+            }
+
+            list.Add(OpCode128);
+            AddPoint(x, y);
+            AddModuleSize(moduleSize);
+            AddWord(height, nameof(height));
+            list.Add((byte)foreground);
+            list.Add((byte)background);
+            list.Add((byte)text.Length);
+            list.AddRange(Encoding.ASCII.GetBytes(text));
+            return this;
+        }
+
+
+        /// <summary>
+        /// Frees all slots
+        /// </summary>
+        public DisplayListBuilder ResetSlots()
+        {
+            list.Add(OpResetSlots);
+            return this;
+        }
+
+
+        /// <summary>
+        /// Restricts the following ops to a rectangle, inside the current one, until <see cref="PopClip"/>.
+        /// Clips end with the list, at most <see cref="MaxClipDepth"/> are pushed at a time
+        /// </summary>
+        /// <param name="x1">Right edge, not included</param>
+        /// <param name="y1">Bottom edge, not included</param>
+        public DisplayListBuilder PushClip(int x0, int y0, int x1, int y1)
+        {
+            if (clipDepth >= MaxClipDepth)
+            {
+                throw new InvalidOperationException($"More than {MaxClipDepth} clips pushed");
+            }
+
+            list.Add(OpPushClip);
+            AddPoint(x0, y0);
+            AddPoint(x1, y1);
+            clipDepth++;
+            return this;
+        }
+
+
+        /// <summary>
+        /// Restores the clip from before the last <see cref="PushClip"/>
+        /// </summary>
+        public DisplayListBuilder PopClip()
+        {
+            if (clipDepth == 0)
+            {
+                throw new InvalidOperationException("No clip to pop");
+            }
+
+            list.Add(OpPopClip);
+            clipDepth--;
+            return this;
+        }
+
+
+        /// <summary>
+        /// Gets the list as sent to the device
+        /// </summary>
+        public byte[] ToArray()
+        {
+            if (list.Count > MaxLength)
+            {
+                throw new PicoPaperException($"The display list is {list.Count} bytes, the device accepts {MaxLength}");
+            }
+            return list.ToArray();
+        }
+
+
+        private void AddPoint(int x, int y)
+        {
+            AddWord(x, nameof(x));
+            AddWord(y, nameof(y));
+        }
+
+
+        private void AddStroke(DrawColors color, int lineWidth, bool flag)
+        {
+            if ((lineWidth < 1) || (lineWidth > 8))
+            {
+                throw new ArgumentOutOfRangeException(nameof(lineWidth), "The line width is 1 to 8 pixels");
+            }
+
+            list.Add((byte)color);
+            list.Add((byte)lineWidth);
+            list.Add((byte)(flag ? 1 : 0));
+        }
+
+
+        private void AddModuleSize(int moduleSize)
+        {
+            if ((moduleSize < 1) || (moduleSize > byte.MaxValue))
+            {
+                throw new ArgumentOutOfRangeException(nameof(moduleSize), $"The module size is 1 to {byte.MaxValue} pixels");
+            }
+            list.Add((byte)moduleSize);
+        }
+
+
+        private void AddFont(DisplayFonts font, int scale)
+        {
+            if (scale < 1 || scale > MaxTextScale)
+            {
+                throw new ArgumentOutOfRangeException(nameof(scale), $"The text scale is 1 to {MaxTextScale}");
+            }
+            if (scale > 1 && font > DisplayFonts.Font24)
+            {
+                throw new ArgumentException("Only the fixed width fonts can be scaled", nameof(scale));
+            }
+            list.Add((byte)((byte)font | ((scale - 1) << 4)));
+        }
+
+
+        private void AddWord(int value, string name)
+        {
+            if ((value < 0) || (value > ushort.MaxValue))
+            {
+                throw new ArgumentOutOfRangeException(name, "Coordinates and sizes are 0 to 65535");
+            }
+
+            list.Add((byte)value);
+            list.Add((byte)(value >> 8));
+        }
+
+    }
+}
@@ -0,0 +1,29 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// How the device dithers a grayscale upload into black and white
+    /// </summary>
+    public enum DitherModes : byte
+    {
+        /// <summary>
+        /// Error diffusion, the closest to the gray levels of the image
+        /// </summary>
+        FloydSteinberg = 0,
+
+        /// <summary>
+        /// Error diffusion that drops a quarter of the error, more contrast and cleaner highlights
+        /// </summary>
+        Atkinson = 1,
+
+        /// <summary>
+        /// Ordered 8x8 pattern, regular and stable between similar images
+        /// </summary>
+        Bayer = 2
+    }
+}
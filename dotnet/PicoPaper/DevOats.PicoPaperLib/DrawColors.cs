@@ -0,0 +1,17 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// Colors of the ops of a <see cref="DisplayListBuilder"/>
+    /// </summary>
+    public enum DrawColors : byte
+    {
+        Black = 0x00,
+        White = 0xFF
+    }
+}
@@ -11,7 +11,8 @@ namespace DevOats.PicoPaperLib
 {
 
     /// <summary>
-    /// Parses a bitmap into the 1 BitPerPixel image format used by the monochrome ePaper display
+    /// Parses a bitmap into the 1 BitPerPixel image format used by the monochrome ePaper display,
+    /// or into grayscale for the device to dither
     /// </summary>
     internal class ImageParser
     {
@@ -63,6 +64,89 @@ namespace DevOats.PicoPaperLib
         }
 
 
+        /// <summary>
+        /// Converts the bitmap to 8 bit grayscale, 0 black to 255 white, for the device to dither.
+        /// Every block of scale x scale pixels becomes one gray pixel that the device scales back up
+        /// </summary>
+        /// <param name="bmp">The bitmap image</param>
+        /// <param name="scale">Pixels per side of a block</param>
+        /// <returns>Rows of (width + scale - 1) / scale gray bytes</returns>
+        public byte[] ParseGrayscale(Bitmap bmp, int scale)
+        {
+            int width = (bmp.Width + scale - 1) / scale;
+            int height = (bmp.Height + scale - 1) / scale;
+
+            byte[] result = new byte[width * height];
+
+            for(int y = 0; y < height; y++)
+            {
+                for(int x = 0; x < width; x++)
+                {
+                    int sum = 0;
+                    int count = 0;
+
+                    for(int blockY = y * scale; blockY < Math.Min((y + 1) * scale, bmp.Height); blockY++)
+                    {
+                        for(int blockX = x * scale; blockX < Math.Min((x + 1) * scale, bmp.Width); blockX++)
+                        {
+                            Color sourceColor = bmp.GetPixel(blockX, blockY);
+                            sum += (sourceColor.R * 299 + sourceColor.G * 587 + sourceColor.B * 114) / 1000;
+                            count++;
+                        }
+                    }
+
+                    result[y * width + x] = (byte)((sum + count / 2) / count);
+                }
+            }
+
+            return result;
+        }
+
+
+        /// <summary>
+        /// Compresses bytes into PackBits runs: a header n, then n + 1 bytes when n is below 128,
+        /// or one byte that repeats 257 - n times when n is above 128
+        /// </summary>
+        /// <param name="data">The bytes to compress</param>
+        /// <returns>The runs</returns>
+        public static byte[] PackBits(byte[] data)
+        {
+            List<byte> packed = new();
+            int index = 0;
+
+            while(index < data.Length)
+            {
+                int repeat = 1;
+                while((index + repeat < data.Length) && (repeat < 128) && (data[index + repeat] == data[index]))
+                {
+                    repeat++;
+                }
+
+                if(repeat > 1)
+                {
+                    packed.Add((byte)(257 - repeat));
+                    packed.Add(data[index]);
+                    index += repeat;
+                    continue;
+                }
+
+                // Literal bytes up to the next repeat
+                int literal = 1;
+                while((index + literal < data.Length) && (literal < 128)
+                    && !((index + literal + 1 < data.Length) && (data[index + literal] == data[index + literal + 1])))
+                {
+                    literal++;
+                }
+
+                packed.Add((byte)(literal - 1));
+                packed.AddRange(new ArraySegment<byte>(data, index, literal));
+                index += literal;
+            }
+
+            return packed.ToArray();
+        }
+
+
         /// <summary>
         /// Calculates the number of bytes needed for an image of the given size. Taken from WaveShare reference code
         /// </summary>
@@ -0,0 +1,39 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// How a layer combines with the layers below it when the device composes them (see <see cref="PicoPaperDevice.ComposeLayers"/>)
+    /// </summary>
+    public enum LayerOps : byte
+    {
+        /// <summary>
+        /// The layer replaces what is below it
+        /// </summary>
+        Copy = 0,
+
+        /// <summary>
+        /// White where either is white, black parts of the layer are transparent
+        /// </summary>
+        Or = 1,
+
+        /// <summary>
+        /// Black where either is black, white parts of the layer are transparent
+        /// </summary>
+        And = 2,
+
+        /// <summary>
+        /// Inverts what is below where the layer is white
+        /// </summary>
+        Xor = 3,
+
+        /// <summary>
+        /// The layer inverted replaces what is below it
+        /// </summary>
+        Not = 4
+    }
+}
@@ -0,0 +1,35 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// How far the panel is turned clockwise from landscape. An image for a turned panel is drawn upright
+    /// and the device rotates it into the layout of the panel (see <see cref="PicoPaperDevice.RotateImage"/>)
+    /// </summary>
+    public enum PanelRotations : byte
+    {
+        /// <summary>
+        /// Landscape, images are 800 x 480
+        /// </summary>
+        None = 0,
+
+        /// <summary>
+        /// Portrait, images are 480 x 800
+        /// </summary>
+        Rotate90 = 1,
+
+        /// <summary>
+        /// Landscape upside down, images are 800 x 480
+        /// </summary>
+        Rotate180 = 2,
+
+        /// <summary>
+        /// Portrait the other way up, images are 480 x 800
+        /// </summary>
+        Rotate270 = 3
+    }
+}
@@ -36,5 +36,80 @@ namespace DevOats.PicoPaperLib
         /// </summary>
         public const byte ShowSplashScreen = 0x05;
 
+        /// <summary>
+        /// Selects the panel that following commands apply to. Followed by the panel index
+        /// </summary>
+        public const byte SelectPanel = 0x06;
+
+        /// <summary>
+        /// Displays the image buffers of all panels, refreshing the panels at the same time
+        /// </summary>
+        public const byte DisplayAllPanels = 0x07;
+
+        /// <summary>
+        /// Sets the refresh mode used to display the image buffer. Followed by the mode
+        /// </summary>
+        public const byte SetRefreshMode = 0x08;
+
+        /// <summary>
+        /// Requests the status and temperature of the selected panel
+        /// </summary>
+        public const byte Status = 0x09;
+
+        /// <summary>
+        /// Selects a waveform profile for following refreshes. Followed by the profile index, or 0xFF for the stock waveforms
+        /// </summary>
+        public const byte SetWaveform = 0x0A;
+
+        /// <summary>
+        /// SetWaveform argument that restores the stock waveforms of the panel
+        /// </summary>
+        public const byte StockWaveform = 0xFF;
+
+        /// <summary>
+        /// Draws a display list into the image buffer and displays it. Followed by the list length, two bytes little endian, and the list
+        /// </summary>
+        public const byte DrawList = 0x0B;
+
+        /// <summary>
+        /// Dithers a grayscale image into the image buffer while it is received. Followed by x, y, width and height,
+        /// two bytes little endian each, the scale, the dither mode, the compression and the pixels.
+        /// With an unknown compression the device answers with an error and ignores everything up to a protocol reset
+        /// </summary>
+        public const byte DitherImage = 0x0C;
+
+        /// <summary>
+        /// DitherImage compression: one byte per pixel
+        /// </summary>
+        public const byte DitherUncompressed = 0x00;
+
+        /// <summary>
+        /// DitherImage compression: PackBits runs of pixels
+        /// </summary>
+        public const byte DitherPackBits = 0x01;
+
+        /// <summary>
+        /// Selects where following images, dithered images and display lists draw. Followed by the layer index,
+        /// or 0xFF for the image buffer of the selected panel. A display list drawn into a layer is not displayed
+        /// </summary>
+        public const byte SelectLayer = 0x0D;
+
+        /// <summary>
+        /// SelectLayer argument for the image buffer of the selected panel
+        /// </summary>
+        public const byte FrameLayer = 0xFF;
+
+        /// <summary>
+        /// Composes layers into the image buffer of the selected panel and displays it. Followed by the number of layers,
+        /// then the index and <see cref="LayerOps"/> of each layer, bottom first
+        /// </summary>
+        public const byte ComposeLayers = 0x0E;
+
+        /// <summary>
+        /// Rotates the image buffer of the selected panel, or the selected layer, into the layout of the panel. Followed by
+        /// the <see cref="PanelRotations"/> the image was drawn for; the buffer holds it packed row by row in its own orientation
+        /// </summary>
+        public const byte RotateImage = 0x0F;
+
     }
 }
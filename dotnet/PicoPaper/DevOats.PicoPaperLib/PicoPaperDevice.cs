@@ -23,9 +23,28 @@ namespace DevOats.PicoPaperLib
         private string AckMessageClearDisplay = "CLR_SCR";
         private string AckMessageSplashScreen = "SPLASH";
         private string AckMessageBufferDisplayed = "DISPLAY";
+        private string AckMessagePanelSelected = "PANEL";
+        private string AckMessageAllPanelsDisplayed = "DISPLAY_ALL";
+        private string AckMessageRefreshMode = "MODE";
+        private string AckMessageWaveform = "WAVEFORM";
+        private string AckMessageDrawList = "DRAW_LIST";
+        private string AckMessageImageDithered = "IMG_DITHERED";
+        private string AckMessageLayerSelected = "LAYER";
+        private string AckMessageLayersComposed = "COMPOSED";
+        private string AckMessageImageRotated = "ROTATED";
 
         private readonly Object deviceAccessLock = new();
 
+        /// <summary>
+        /// Largest scale of <see cref="UploadBitmapDithered"/>
+        /// </summary>
+        public const int MaxDitherScale = 8;
+
+        /// <summary>
+        /// Number of layers the device keeps (see <see cref="SelectLayer"/>)
+        /// </summary>
+        public const int LayerCount = 3;
+
 
         /// <summary>
         /// Gets whether the serial port is connected
@@ -70,7 +89,7 @@ namespace DevOats.PicoPaperLib
                 {
                     connection.SendDataByte(PicoPaperCommands.Ident);
                     DeviceResponse response = WaitForResponse();
-                    PicoPaperDeviceInfo identInfo = ParseIdentInfo(response.Message);
+                    PicoPaperDeviceInfo identInfo = ParseJsonMessage<PicoPaperDeviceInfo>(response, "device info");
                     return identInfo;
                 }
                 catch (IOException ex)
@@ -81,6 +100,86 @@ namespace DevOats.PicoPaperLib
         }
 
 
+        /// <summary>
+        /// Requests the status of the selected panel: temperature, refresh mode and the estimated refresh time
+        /// </summary>
+        public PicoPaperStatus GetStatus()
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataByte(PicoPaperCommands.Status);
+                    DeviceResponse response = WaitForResponse();
+                    return ParseJsonMessage<PicoPaperStatus>(response, "status");
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception getting status: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Sets the refresh mode used to display images
+        /// </summary>
+        /// <param name="mode">The refresh mode. The device uses a full refresh when the panel is too cold</param>
+        public void SetRefreshMode(RefreshModes mode)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataByte(PicoPaperCommands.SetRefreshMode);
+                    connection.SendDataByte((byte)mode);
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageRefreshMode);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while setting the refresh mode: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Selects a waveform profile stored on the device for following refreshes.
+        /// The profile replaces the refresh mode; the device falls back to the stock waveforms when the panel is too cold
+        /// The profiles are experimental, untuned starting points; check the image quality on the panel before relying on them
+        /// </summary>
+        /// <param name="profileName">The profile name as reported by Ident, or null for the stock waveforms</param>
+        public void SetWaveform(string? profileName)
+        {
+            byte profile = PicoPaperCommands.StockWaveform;
+            if (profileName != null)
+            {
+                int index = Array.IndexOf(Ident().Waveforms, profileName);
+                if (index < 0)
+                {
+                    throw new PicoPaperException($"Unknown waveform profile: {profileName}");
+                }
+                profile = (byte)index;
+            }
+
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataByte(PicoPaperCommands.SetWaveform);
+                    connection.SendDataByte(profile);
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageWaveform);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while setting the waveform: " + ex.Message, ex);
+                }
+            }
+        }
+
+
         /// <summary>
         /// Shows the device splash screen on the ePaper
         /// </summary>
@@ -164,39 +263,374 @@ namespace DevOats.PicoPaperLib
         /// <summary>
         /// Displays a bitmap image on the ePaper display (Currently only 800 x 480 is supported)
         /// </summary>
-        /// <param name="image">The image to be displayed</param>
-        public void DisplayBitmap(Bitmap image)
+        /// <param name="image">The image to be displayed, 480 x 800 for a panel in portrait</param>
+        /// <param name="rotation">How the panel is mounted, the device rotates the image into its layout</param>
+        public void DisplayBitmap(Bitmap image, PanelRotations rotation = PanelRotations.None)
         {
             lock (deviceAccessLock)
             {
                 try
                 {
-                    if ((image.Width != 800) || (image.Height != 480))
-                    {
-                        throw new ArgumentException("Unsupported image dimensions. Only 800 x 480 is supported");
-                    }
+                    SendImage(image, rotation);
 
-                    ImageParser parser = new ImageParser();
-                    byte[] imgData = parser.ParseBitmap(image);
-
-                    connection.SendDataByte(PicoPaperCommands.StartImageTx);
-                    connection.SendDataBytes(imgData);
+                    connection.SendDataByte(PicoPaperCommands.DisplayImageBuffer);
                     DeviceResponse response = WaitForResponse();
-                    ValidateAck(response, AckMessageImageReceived);
+                    ValidateAck(response, AckMessageBufferDisplayed);
+
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while displaying image: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Uploads a bitmap in grayscale and displays it. The device dithers it into black and white
+        /// (see <see cref="UploadBitmapDithered"/>)
+        /// </summary>
+        /// <param name="image">The image, at most 800 x 480, drawn at the top left</param>
+        /// <param name="mode">How the device dithers</param>
+        /// <param name="scale">The device draws every uploaded pixel as scale x scale pixels, 1 to <see cref="MaxDitherScale"/></param>
+        public void DisplayBitmapDithered(Bitmap image, DitherModes mode, int scale = 1)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    SendDitheredImage(image, mode, scale);
 
                     connection.SendDataByte(PicoPaperCommands.DisplayImageBuffer);
-                    response = WaitForResponse();
+                    DeviceResponse response = WaitForResponse();
                     ValidateAck(response, AckMessageBufferDisplayed);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while displaying a dithered image: " + ex.Message, ex);
+                }
+            }
+        }
+
 
+        /// <summary>
+        /// Uploads a bitmap in grayscale to the image buffer of the selected panel without displaying it.
+        /// The device dithers it while it is received, so the host does no image processing.
+        /// The pixels are PackBits compressed when that is shorter; a scale above 1 uploads scale x scale fewer pixels
+        /// </summary>
+        /// <param name="image">The image, at most 800 x 480, drawn at the top left</param>
+        /// <param name="mode">How the device dithers</param>
+        /// <param name="scale">The device draws every uploaded pixel as scale x scale pixels, 1 to <see cref="MaxDitherScale"/></param>
+        public void UploadBitmapDithered(Bitmap image, DitherModes mode, int scale = 1)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    SendDitheredImage(image, mode, scale);
                 }
                 catch (IOException ex)
                 {
-                    throw new PicoPaperException($"Communication Exception while displaying image: " + ex.Message, ex);
+                    throw new PicoPaperException($"Communication Exception while uploading a dithered image: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Draws a display list into the image buffer of the selected panel and displays it.
+        /// The list draws over what the buffer holds; a partial refresh only sends the region it changed
+        /// </summary>
+        /// <param name="displayList">The drawing ops</param>
+        public void DrawDisplayList(DisplayListBuilder displayList)
+        {
+            byte[] listData = displayList.ToArray();
+
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataByte(PicoPaperCommands.DrawList);
+                    connection.SendDataByte((byte)listData.Length);
+                    connection.SendDataByte((byte)(listData.Length >> 8));
+                    connection.SendDataBytes(listData);
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageDrawList);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while drawing a display list: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Selects where following uploads, dithered uploads and display lists draw. A layer is a full size image
+        /// kept on the device, such as a background drawn once or an overlay that changes; display lists drawn into
+        /// a layer are not displayed. <see cref="ComposeLayers"/> combines the layers into the image buffer
+        /// </summary>
+        /// <param name="layer">The layer index, 0 to <see cref="LayerCount"/> - 1, or null for the image buffer of the selected panel</param>
+        public void SelectLayer(int? layer)
+        {
+            if ((layer < 0) || (layer >= LayerCount))
+            {
+                throw new ArgumentOutOfRangeException(nameof(layer), "Invalid layer index");
+            }
+
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataByte(PicoPaperCommands.SelectLayer);
+                    connection.SendDataByte((layer == null) ? PicoPaperCommands.FrameLayer : (byte)layer);
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageLayerSelected);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while selecting a layer: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Composes layers into the image buffer of the selected panel and displays it.
+        /// Each layer combines with the layers below it; a partial refresh only sends what the composition changed
+        /// </summary>
+        /// <param name="layers">The layers, bottom first, each selected and drawn at least once</param>
+        public void ComposeLayers(IReadOnlyList<(int Layer, LayerOps Op)> layers)
+        {
+            if ((layers.Count == 0) || (layers.Count > LayerCount))
+            {
+                throw new ArgumentException($"Between 1 and {LayerCount} layers can be composed");
+            }
+
+            List<byte> command = new List<byte> { PicoPaperCommands.ComposeLayers, (byte)layers.Count };
+            foreach ((int layer, LayerOps op) in layers)
+            {
+                if ((layer < 0) || (layer >= LayerCount))
+                {
+                    throw new ArgumentOutOfRangeException(nameof(layers), "Invalid layer index");
+                }
+                command.Add((byte)layer);
+                command.Add((byte)op);
+            }
+
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataBytes(command.ToArray());
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageLayersComposed);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while composing layers: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Rotates what was uploaded or drawn into the image buffer of the selected panel, or the selected layer,
+        /// into the layout of the panel without displaying it. The buffer holds an image drawn upright for a panel
+        /// mounted with the given rotation, such as 480 x 800 bytes of a portrait image sent as they are
+        /// </summary>
+        /// <param name="rotation">How the panel is mounted</param>
+        public void RotateImage(PanelRotations rotation)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    SendRotateImage(rotation);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while rotating image: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Selects the panel that following uploads and display commands apply to
+        /// </summary>
+        /// <param name="panel">The panel index, starting at 0 (see <see cref="PicoPaperDeviceInfo.Panels"/>)</param>
+        public void SelectPanel(int panel)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    SendSelectPanel(panel);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while selecting panel: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Uploads a bitmap to the image buffer of the selected panel without displaying it (Currently only 800 x 480 is supported)
+        /// </summary>
+        /// <param name="image">The image to be uploaded, 480 x 800 for a panel in portrait</param>
+        /// <param name="rotation">How the panel is mounted, the device rotates the image into its layout</param>
+        public void UploadBitmap(Bitmap image, PanelRotations rotation = PanelRotations.None)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    SendImage(image, rotation);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while uploading image: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Displays the image buffers of all panels. The panels refresh at the same time
+        /// </summary>
+        public void DisplayAllPanels()
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    connection.SendDataByte(PicoPaperCommands.DisplayAllPanels);
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageAllPanelsDisplayed);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while displaying all panels: " + ex.Message, ex);
                 }
             }
         }
 
 
+        /// <summary>
+        /// Uploads one bitmap per panel and displays them, refreshing all panels at the same time
+        /// </summary>
+        /// <param name="images">The images, the first one goes to panel 0</param>
+        public void DisplayBitmaps(IReadOnlyList<Bitmap> images)
+        {
+            lock (deviceAccessLock)
+            {
+                try
+                {
+                    for (int panel = 0; panel < images.Count; panel++)
+                    {
+                        SendSelectPanel(panel);
+                        SendImage(images[panel]);
+                    }
+                    SendSelectPanel(0);
+
+                    connection.SendDataByte(PicoPaperCommands.DisplayAllPanels);
+                    DeviceResponse response = WaitForResponse();
+                    ValidateAck(response, AckMessageAllPanelsDisplayed);
+                }
+                catch (IOException ex)
+                {
+                    throw new PicoPaperException($"Communication Exception while displaying images: " + ex.Message, ex);
+                }
+            }
+        }
+
+
+        private void SendSelectPanel(int panel)
+        {
+            if ((panel < 0) || (panel > byte.MaxValue))
+            {
+                throw new ArgumentOutOfRangeException(nameof(panel), "Invalid panel index");
+            }
+
+            connection.SendDataByte(PicoPaperCommands.SelectPanel);
+            connection.SendDataByte((byte)panel);
+            DeviceResponse response = WaitForResponse();
+            ValidateAck(response, AckMessagePanelSelected);
+        }
+
+
+        private void SendImage(Bitmap image, PanelRotations rotation = PanelRotations.None)
+        {
+            bool portrait = (rotation == PanelRotations.Rotate90) || (rotation == PanelRotations.Rotate270);
+            if (portrait && ((image.Width != 480) || (image.Height != 800)))
+            {
+                throw new ArgumentException("Unsupported image dimensions. Only 480 x 800 is supported in portrait");
+            }
+            if (!portrait && ((image.Width != 800) || (image.Height != 480)))
+            {
+                throw new ArgumentException("Unsupported image dimensions. Only 800 x 480 is supported");
+            }
+
+            ImageParser parser = new ImageParser();
+            byte[] imgData = parser.ParseBitmap(image);
+
+            connection.SendDataByte(PicoPaperCommands.StartImageTx);
+            connection.SendDataBytes(imgData);
+            DeviceResponse response = WaitForResponse();
+            ValidateAck(response, AckMessageImageReceived);
+
+            if (rotation != PanelRotations.None)
+            {
+                SendRotateImage(rotation);
+            }
+        }
+
+
+        private void SendRotateImage(PanelRotations rotation)
+        {
+            connection.SendDataByte(PicoPaperCommands.RotateImage);
+            connection.SendDataByte((byte)rotation);
+            DeviceResponse response = WaitForResponse();
+            ValidateAck(response, AckMessageImageRotated);
+        }
+
+
+        private void SendDitheredImage(Bitmap image, DitherModes mode, int scale)
+        {
+            if ((image.Width > 800) || (image.Height > 480))
+            {
+                throw new ArgumentException("Unsupported image dimensions. The image can be at most 800 x 480");
+            }
+            if ((scale < 1) || (scale > MaxDitherScale))
+            {
+                throw new ArgumentOutOfRangeException(nameof(scale), $"The dither scale is 1 to {MaxDitherScale}");
+            }
+
+            ImageParser parser = new ImageParser();
+            byte[] grayData = parser.ParseGrayscale(image, scale);
+            byte[] packedData = ImageParser.PackBits(grayData);
+            bool packed = packedData.Length < grayData.Length;
+            int width = (image.Width + scale - 1) / scale;
+            int height = (image.Height + scale - 1) / scale;
+
+            connection.SendDataBytes(new byte[]
+            {
+                PicoPaperCommands.DitherImage,
+                0, 0, 0, 0,
+                (byte)width, (byte)(width >> 8),
+                (byte)height, (byte)(height >> 8),
+                (byte)scale,
+                (byte)mode,
+                packed ? PicoPaperCommands.DitherPackBits : PicoPaperCommands.DitherUncompressed
+            });
+            connection.SendDataBytes(packed ? packedData : grayData);
+            DeviceResponse response = WaitForResponse();
+            ValidateAck(response, AckMessageImageDithered);
+        }
+
+
         private void ValidateAck(DeviceResponse response, string ackMessage)
         {
             if(response.ResponseType == ResponseTypes.Error)
@@ -235,9 +669,14 @@ namespace DevOats.PicoPaperLib
         }
 
 
-        private PicoPaperDeviceInfo ParseIdentInfo(string message)
+        private T ParseJsonMessage<T>(DeviceResponse response, string description) where T : class
         {
-            PicoPaperDeviceInfo? info;
+            T? info;
+
+            if (response.ResponseType == ResponseTypes.Error)
+            {
+                throw new PicoPaperException($"PicoPaper device error: {response.Message}");
+            }
 
             JsonSerializerOptions serializeroptions = new()
             {
@@ -246,16 +685,16 @@ namespace DevOats.PicoPaperLib
 
             try
             {
-                info = JsonSerializer.Deserialize<PicoPaperDeviceInfo>(message, serializeroptions);
+                info = JsonSerializer.Deserialize<T>(response.Message, serializeroptions);
             }
             catch(Exception ex)
             {
-                throw new PicoPaperException($"Could not deserialize device info: {ex.Message}", ex);
+                throw new PicoPaperException($"Could not deserialize {description}: {ex.Message}", ex);
             }
                 
             if (info == null)
             {
-                throw new PicoPaperException("Could not deserialize device info");
+                throw new PicoPaperException($"Could not deserialize {description}");
             }
             else
             {
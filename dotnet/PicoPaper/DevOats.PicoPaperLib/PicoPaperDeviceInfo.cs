@@ -13,6 +13,13 @@ namespace DevOats.PicoPaperLib
         public string Version { get; set; } = default!;
         public DisplayInfo Display { get; set; } = default!;
         public string Board { get; set; } = default!;
+        public int Panels { get; set; } = 1;
+        public int? Temperature { get; set; }
+
+        /// <summary>
+        /// Names of the waveform profiles stored on the device
+        /// </summary>
+        public string[] Waveforms { get; set; } = Array.Empty<string>();
         public string Id { get; set; } = default!;
     }
 }
@@ -0,0 +1,41 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// Status of the selected panel
+    /// </summary>
+    public class PicoPaperStatus
+    {
+        public int Panel { get; set; }
+
+        /// <summary>
+        /// Panel temperature in degrees Celsius
+        /// </summary>
+        public int Temperature { get; set; }
+
+        /// <summary>
+        /// The raw controller status flags
+        /// </summary>
+        public int Status { get; set; }
+
+        /// <summary>
+        /// The refresh mode that will be used at this temperature
+        /// </summary>
+        public string Mode { get; set; } = default!;
+
+        /// <summary>
+        /// The waveform profile that will be used, or "stock"
+        /// </summary>
+        public string Waveform { get; set; } = default!;
+
+        /// <summary>
+        /// Estimated duration of a refresh in milliseconds
+        /// </summary>
+        public int RefreshMs { get; set; }
+    }
+}
@@ -0,0 +1,35 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// Error correction level of a QR code, the part of the symbol that can be damaged and still read
+    /// (see <see cref="DisplayListBuilder.QrCode(int, int, byte[], QrErrorCorrection, int, DrawColors, DrawColors)"/>)
+    /// </summary>
+    public enum QrErrorCorrection : byte
+    {
+        /// <summary>
+        /// Level L, 7%
+        /// </summary>
+        Low = 0,
+
+        /// <summary>
+        /// Level M, 15%
+        /// </summary>
+        Medium = 1,
+
+        /// <summary>
+        /// Level Q, 25%
+        /// </summary>
+        Quartile = 2,
+
+        /// <summary>
+        /// Level H, 30%
+        /// </summary>
+        High = 3
+    }
+}
@@ -0,0 +1,19 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace DevOats.PicoPaperLib
+{
+    /// <summary>
+    /// Defines how the ePaper display is refreshed.
+    /// The device falls back to a full refresh when the panel is too cold for the faster modes
+    /// </summary>
+    public enum RefreshModes
+    {
+        Full = 0,
+        Fast = 1,
+        Partial = 2
+    }
+}
@@ -155,6 +155,7 @@ namespace DevOats.PicoPaperLib
         /// Sends a single databyte to the PicoPaper device
         /// </summary>
         /// <param name="data"></param>
+        public void SendDataByte(byte data)
         {
             StringBuilder builder = new StringBuilder();
             builder.Append(DatabyteStartChar);
@@ -34,13 +34,22 @@
 /**
  * GPIO
 **/
-int EPD_RST_PIN;
-int EPD_DC_PIN;
-int EPD_CS_PIN;
-int EPD_BUSY_PIN;
 int EPD_CLK_PIN;
 int EPD_MOSI_PIN;
 
+/**
+ * Panel pins: RST, DC, CS, BUSY
+ * Panel 0 is the Waveshare Pico-ePaper wiring. Adjust the others to the harness
+**/
+EPD_PANEL EPD_Panels[EPD_MAX_PANELS] = {
+	{12,  8,  9, 13},
+	{ 7,  6,  5,  4},
+	{ 3,  2,  1,  0},
+	{18, 16, 17, 19},
+};
+UBYTE EPD_Panel_Count;
+UBYTE EPD_Panel_Active;
+
 /**
  * GPIO read and write
 **/
@@ -90,21 +99,36 @@ void DEV_Delay_ms(UDOUBLE xms)
 
 void DEV_GPIO_Init(void)
 {
-
-	EPD_RST_PIN     = 12;
-	EPD_DC_PIN      = 8;
-	EPD_BUSY_PIN    = 13;
-	
-	EPD_CS_PIN      = 9;
 	EPD_CLK_PIN		= 10;
 	EPD_MOSI_PIN	= 11;
 
-	DEV_GPIO_Mode(EPD_RST_PIN, 1);
-	DEV_GPIO_Mode(EPD_DC_PIN, 1);
-	DEV_GPIO_Mode(EPD_CS_PIN, 1);
-	DEV_GPIO_Mode(EPD_BUSY_PIN, 0);
+	EPD_Panel_Count = (EPD_PANEL_COUNT > EPD_MAX_PANELS)? EPD_MAX_PANELS: EPD_PANEL_COUNT;
 
-	DEV_Digital_Write(EPD_CS_PIN, 1);
+	for(EPD_Panel_Active = 0; EPD_Panel_Active < EPD_Panel_Count; EPD_Panel_Active++) {
+		DEV_GPIO_Mode(EPD_RST_PIN, 1);
+		DEV_GPIO_Mode(EPD_DC_PIN, 1);
+		DEV_GPIO_Mode(EPD_CS_PIN, 1);
+		DEV_GPIO_Mode(EPD_BUSY_PIN, 0);
+
+		DEV_Digital_Write(EPD_CS_PIN, 1);
+	}
+	EPD_Panel_Active = 0;
+}
+
+/******************************************************************************
+function:	Select the panel that the EPD_*_PIN pins refer to
+parameter:
+	Panel : Panel index, 0 .. EPD_Panel_Count-1
+Info:
+	Returns 1 if the panel does not exist, the selection is unchanged then
+******************************************************************************/
+UBYTE DEV_Select_Panel(UBYTE Panel)
+{
+	if(Panel >= EPD_Panel_Count) {
+		return 1;
+	}
+	EPD_Panel_Active = Panel;
+	return 0;
 }
 /******************************************************************************
 function:	Module Initialize, the library and initialize the pins, SPI protocol
@@ -48,8 +48,14 @@
 #ifndef _DEV_CONFIG_H_
 #define _DEV_CONFIG_H_
 
+#ifdef PICOPAPER_HOST_SIM
+// Host build, the functions below are implemented by sim/DEV_Config_sim.c
+#include <stdint.h>
+#include <stdbool.h>
+#else
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
+#endif
 #include "stdio.h"
 
 /**
@@ -61,11 +67,30 @@
 
 /**
  * GPIOI config
+ * All panels share SPI, CLK and MOSI. Every panel has its own CS/DC/RST/BUSY
 **/
-extern int EPD_RST_PIN;
-extern int EPD_DC_PIN;
-extern int EPD_CS_PIN;
-extern int EPD_BUSY_PIN;
+#ifndef EPD_PANEL_COUNT
+#define EPD_PANEL_COUNT     1       // Number of panels wired to this controller
+#endif
+#define EPD_MAX_PANELS      4
+
+typedef struct {
+    int RST_PIN;
+    int DC_PIN;
+    int CS_PIN;
+    int BUSY_PIN;
+} EPD_PANEL;
+
+extern EPD_PANEL EPD_Panels[EPD_MAX_PANELS];
+extern UBYTE EPD_Panel_Count;
+extern UBYTE EPD_Panel_Active;
+
+// Pins of the selected panel
+#define EPD_RST_PIN     (EPD_Panels[EPD_Panel_Active].RST_PIN)
+#define EPD_DC_PIN      (EPD_Panels[EPD_Panel_Active].DC_PIN)
+#define EPD_CS_PIN      (EPD_Panels[EPD_Panel_Active].CS_PIN)
+#define EPD_BUSY_PIN    (EPD_Panels[EPD_Panel_Active].BUSY_PIN)
+
 extern int EPD_CLK_PIN;
 extern int EPD_MOSI_PIN;
 
@@ -77,6 +102,8 @@ void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
 void DEV_Delay_ms(UDOUBLE xms);
 
+UBYTE DEV_Select_Panel(UBYTE Panel);
+
 UBYTE DEV_Module_Init(void);
 void DEV_Module_Exit(void);
 void DEV_GPIO_Init_1(void);
@@ -0,0 +1,440 @@
+/**
+  ******************************************************************************
+  * @file    Font10AA.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   Anti-aliased Font10AA, the glyphs of font20.c at half size
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for Courier New 12pt, anti-aliased, 2 bits of coverage per pixel
+// 
+
+const uint8_t Font10AA_Bitmap[] = 
+{
+	// @0 ' ' (0x0)
+
+	// @0 '!' (2x7)
+	0x6B, 0xBB, 0x20, 0xB0,
+
+	// @4 '"' (5x3)
+	0xB3, 0x98, 0x92, 0x20,
+
+	// @8 '#' (5x8)
+	0x33, 0x0C, 0xCB, 0xBA, 0xEE, 0xBB, 0xAE, 0xE3, 0x30, 0xCC,
+
+	// @18 '$' (5x8)
+	0x0C, 0x0B, 0xEA, 0x15, 0xF8, 0x52, 0xAA, 0x96, 0xD0, 0x30,
+
+	// @28 '%' (5x7)
+	0x60, 0x22, 0x0A, 0x54, 0xA9, 0xE6, 0x02, 0x20, 0xA4,
+
+	// @37 '&' (5x6)
+	0x0A, 0x4E, 0x92, 0x41, 0xFB, 0xA7, 0x5B, 0xB0,
+
+	// @45 '\'' (2x3)
+	0xE9, 0x80,
+
+	// @47 '(' (2x9)
+	0x26, 0xAC, 0xCC, 0xA6, 0x20,
+
+	// @52 ')' (2x9)
+	0x89, 0xA3, 0x33, 0xA9, 0x80,
+
+	// @57 '*' (5x5)
+	0x08, 0x03, 0x0A, 0xE8, 0xB8, 0x3B, 0x00,
+
+	// @64 '+' (5x6)
+	0x08, 0x03, 0x0A, 0xEA, 0xBA, 0x0C, 0x02, 0x00,
+
+	// @72 ',' (3x4)
+	0x24, 0xCA, 0x10,
+
+	// @75 '-' (5x2)
+	0xAA, 0x6A, 0x90,
+
+	// @78 '.' (2x2)
+	0x9E,
+
+	// @79 '/' (5x8)
+	0x02, 0x80, 0xC0, 0x60, 0x24, 0x18, 0x09, 0x03, 0x02, 0x80,
+
+	// @89 '0' (5x7)
+	0x29, 0x2A, 0xCC, 0x2B, 0x0A, 0xC2, 0xA4, 0x97, 0xE0,
+
+	// @98 '1' (5x7)
+	0x08, 0x2F, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0B, 0xF8,
+
+	// @107 '2' (5x7)
+	0x29, 0x2A, 0xD8, 0x28, 0x18, 0x18, 0x18, 0x0F, 0xF8,
+
+	// @116 '3' (6x7)
+	0x0A, 0x43, 0xAD, 0x00, 0xA0, 0xBC, 0x00, 0xA5, 0x0A, 0x7F, 0x80,
+
+	// @127 '4' (5x7)
+	0x06, 0x03, 0xC2, 0x71, 0x8C, 0xEB, 0x6A, 0xD0, 0xF8,
+
+	// @136 '5' (5x7)
+	0x6A, 0x2A, 0x8A, 0x92, 0xAD, 0x02, 0xA0, 0xAB, 0xE0,
+
+	// @145 '6' (5x7)
+	0x0A, 0x5E, 0x9A, 0x03, 0xB8, 0xD2, 0xA4, 0xA6, 0xE0,
+
+	// @154 '7' (5x7)
+	0xAA, 0x7A, 0xA0, 0x24, 0x0C, 0x0A, 0x02, 0x40, 0xC0,
+
+	// @163 '8' (5x7)
+	0x29, 0x2A, 0xDD, 0x2A, 0xFC, 0xD2, 0xB4, 0xA7, 0xE0,
+
+	// @172 '9' (5x7)
+	0x28, 0x2A, 0xCC, 0x2A, 0xAE, 0x2A, 0x82, 0xCF, 0x90,
+
+	// @181 ':' (2x5)
+	0x9E, 0x09, 0xE0,
+
+	// @184 ';' (3x6)
+	0x18, 0xB0, 0x09, 0x62, 0x40,
+
+	// @189 '<' (6x6)
+	0x00, 0x20, 0x2E, 0x1A, 0x06, 0x80, 0x07, 0x80, 0x0B,
+
+	// @198 '=' (6x4)
+	0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+
+	// @204 '>' (6x6)
+	0x80, 0x0B, 0x80, 0x0A, 0x40, 0x29, 0x2D, 0x0E, 0x00,
+
+	// @213 '?' (5x6)
+	0x7E, 0x28, 0xA0, 0x64, 0x34, 0x00, 0x0B, 0x00,
+
+	// @221 '@' (4x8)
+	0x09, 0x22, 0x82, 0x8A, 0x8A, 0x86, 0x21, 0x19,
+
+	// @229 'A' (7x6)
+	0x2F, 0x80, 0x1A, 0x00, 0x9C, 0x07, 0xA8, 0x2A, 0xA2, 0xE2, 0xE0,
+
+	// @240 'B' (5x6)
+	0xFE, 0x28, 0xAA, 0xB6, 0xAA, 0xA0, 0xFF, 0xE0,
+
+	// @248 'C' (5x6)
+	0x2E, 0xE8, 0x7C, 0x03, 0x00, 0xA1, 0xCB, 0xD0,
+
+	// @256 'D' (6x6)
+	0xBF, 0x83, 0x0A, 0x30, 0x33, 0x03, 0x30, 0xAB, 0xF8,
+
+	// @265 'E' (5x6)
+	0xFF, 0xE8, 0x3A, 0xA2, 0xA8, 0xA0, 0xFF, 0xF0,
+
+	// @273 'F' (5x6)
+	0xFF, 0xE8, 0x3A, 0xA2, 0xA8, 0xA0, 0x3F, 0x00,
+
+	// @281 'G' (6x6)
+	0x6E, 0xC9, 0x1C, 0xC0, 0x0C, 0xBE, 0x90, 0xC6, 0xF8,
+
+	// @290 'H' (5x6)
+	0xF3, 0xE8, 0xAA, 0xAA, 0xAA, 0xA2, 0xBC, 0xF0,
+
+	// @298 'I' (5x6)
+	0xBF, 0x83, 0x00, 0xC0, 0x30, 0x0C, 0x2F, 0xE0,
+
+	// @306 'J' (6x6)
+	0x0F, 0xE0, 0x28, 0x02, 0x8C, 0x28, 0xC2, 0x8B, 0xE0,
+
+	// @315 'K' (6x6)
+	0xFB, 0xEA, 0x64, 0xAC, 0x0A, 0x60, 0xA2, 0x4F, 0x9E,
+
+	// @324 'L' (5x6)
+	0xFC, 0x0C, 0x03, 0x00, 0xC2, 0x30, 0xFF, 0xF0,
+
+	// @332 'M' (7x6)
+	0xB8, 0xB8, 0xE2, 0xC3, 0xAB, 0x0D, 0xDC, 0x32, 0x32, 0xF3, 0xE0,
+
+	// @343 'N' (5x6)
+	0xEB, 0xED, 0xAA, 0xAA, 0xAA, 0xA7, 0xBE, 0xA0,
+
+	// @351 'O' (5x6)
+	0x2E, 0x28, 0xAC, 0x0F, 0x03, 0xA2, 0x8B, 0x80,
+
+	// @359 'P' (5x6)
+	0xFF, 0x68, 0x7A, 0x1E, 0xFD, 0xA0, 0x3F, 0x00,
+
+	// @367 'Q' (5x8)
+	0x2E, 0x28, 0xAC, 0x0F, 0x03, 0xA2, 0x8B, 0x82, 0xEC, 0x89,
+
+	// @377 'R' (6x6)
+	0xFF, 0x4A, 0x1C, 0xAA, 0x8A, 0xB4, 0xA2, 0x8F, 0x8A,
+
+	// @386 'S' (5x6)
+	0x7E, 0xF4, 0x7A, 0x90, 0x6A, 0xD1, 0xFB, 0xD0,
+
+	// @394 'T' (5x6)
+	0xFF, 0xF3, 0x38, 0xC8, 0x30, 0x0C, 0x0F, 0xC0,
+
+	// @402 'U' (5x6)
+	0xF3, 0xE8, 0xAA, 0x2A, 0x8A, 0xA2, 0x8B, 0x80,
+
+	// @410 'V' (6x6)
+	0xB8, 0xF3, 0x0A, 0x28, 0xC0, 0xE8, 0x0A, 0x40, 0xB0,
+
+	// @419 'W' (7x6)
+	0xBC, 0xBC, 0xC9, 0xA3, 0x3A, 0x8A, 0xB9, 0x2C, 0xB0, 0xA1, 0xC0,
+
+	// @430 'X' (6x6)
+	0xB8, 0xF2, 0x49, 0x0A, 0x40, 0xA4, 0x24, 0x9B, 0x8F,
+
+	// @439 'Y' (5x6)
+	0xF3, 0xD8, 0x92, 0xE0, 0x30, 0x0C, 0x0F, 0xC0,
+
+	// @447 'Z' (5x6)
+	0xBF, 0xA8, 0x90, 0x90, 0x60, 0x62, 0xAF, 0xE0,
+
+	// @455 '[' (2x9)
+	0xAE, 0xCC, 0xCC, 0xCE, 0xA0,
+
+	// @460 '\\' (5x8)
+	0xA0, 0x0C, 0x02, 0x40, 0x60, 0x09, 0x01, 0x80, 0x30, 0x0A,
+
+	// @470 ']' (2x9)
+	0xAB, 0x33, 0x33, 0x3B, 0xA0,
+
+	// @475 '^' (5x4)
+	0x04, 0x0A, 0x49, 0x25, 0x01,
+
+	// @480 '_' (7x1)
+	0xFF, 0xFC,
+
+	// @482 '`' (3x2)
+	0x40, 0x90,
+
+	// @484 'a' (5x5)
+	0x2A, 0x1A, 0xA7, 0xFB, 0x4A, 0xBE, 0xC0,
+
+	// @491 'b' (6x7)
+	0x60, 0x07, 0x00, 0x36, 0x43, 0xAA, 0x30, 0x33, 0x46, 0xBB, 0x90,
+
+	// @502 'c' (5x5)
+	0x19, 0xAA, 0xBC, 0x0B, 0x42, 0x7F, 0x80,
+
+	// @509 'd' (6x7)
+	0x01, 0x80, 0x1C, 0x19, 0xCA, 0xAC, 0xC0, 0xCD, 0x1C, 0x6E, 0xE0,
+
+	// @520 'e' (5x5)
+	0x19, 0x2A, 0xAF, 0xFE, 0x42, 0x6F, 0x80,
+
+	// @527 'f' (5x7)
+	0x0A, 0x8A, 0xA6, 0xA5, 0xA9, 0x28, 0x0A, 0x0B, 0xF8,
+
+	// @536 'g' (6x7)
+	0x19, 0x9A, 0xAD, 0xC0, 0xC9, 0x1C, 0x6E, 0xC0, 0x1C, 0x3F, 0x40,
+
+	// @547 'h' (5x7)
+	0x90, 0x28, 0x0A, 0xA2, 0xEA, 0xA2, 0xA8, 0xAF, 0x3C,
+
+	// @556 'i' (5x7)
+	0x08, 0x02, 0x06, 0x81, 0xB0, 0x0C, 0x03, 0x0B, 0xF8,
+
+	// @565 'j' (4x9)
+	0x08, 0x08, 0x6A, 0x6B, 0x03, 0x03, 0x03, 0x07, 0xFD,
+
+	// @574 'k' (5x7)
+	0x90, 0x28, 0x0A, 0xA6, 0xB9, 0xB8, 0x2A, 0x4E, 0xBC,
+
+	// @583 'l' (5x7)
+	0x68, 0x1B, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0B, 0xF8,
+
+	// @592 'm' (7x5)
+	0x69, 0x91, 0xEE, 0xC3, 0x33, 0x0C, 0xCC, 0xBB, 0xB8,
+
+	// @601 'n' (5x5)
+	0x9A, 0x2E, 0xAA, 0x2A, 0x8A, 0xF3, 0xC0,
+
+	// @608 'o' (5x5)
+	0x19, 0x2A, 0xAC, 0x0E, 0x46, 0x6E, 0x40,
+
+	// @615 'p' (6x7)
+	0x66, 0x47, 0xAA, 0x30, 0x33, 0x46, 0x3B, 0x93, 0x00, 0xBC, 0x00,
+
+	// @626 'q' (6x7)
+	0x19, 0x9A, 0xAD, 0xC0, 0xC9, 0x1C, 0x6E, 0xC0, 0x0C, 0x03, 0xE0,
+
+	// @637 'r' (5x5)
+	0xA2, 0x6E, 0xB3, 0x40, 0xC0, 0xFF, 0x00,
+
+	// @644 's' (5x5)
+	0x1A, 0x6A, 0xA7, 0xA1, 0x5A, 0xBE, 0x40,
+
+	// @651 't' (5x6)
+	0x30, 0x2E, 0x9B, 0xA4, 0xC0, 0x30, 0x8B, 0xE0,
+
+	// @659 'u' (5x5)
+	0x92, 0x68, 0xAA, 0x2A, 0x8A, 0x7E, 0xC0,
+
+	// @666 'v' (6x5)
+	0x64, 0xA7, 0x4A, 0x28, 0xC0, 0xE8, 0x0B, 0x00,
+
+	// @674 'w' (6x5)
+	0x64, 0xA7, 0x5A, 0x36, 0xA2, 0xEC, 0x28, 0xC0,
+
+	// @682 'x' (5x5)
+	0xA2, 0xAC, 0xE1, 0xD0, 0xA8, 0xF3, 0xC0,
+
+	// @689 'y' (6x7)
+	0x64, 0xA7, 0x4A, 0x28, 0xC0, 0xE8, 0x0A, 0x00, 0x90, 0xBF, 0x00,
+
+	// @700 'z' (5x5)
+	0x6A, 0x6A, 0xD0, 0x90, 0x95, 0xBF, 0x80,
+
+	// @707 '{' (3x9)
+	0x18, 0xE3, 0x0C, 0xA1, 0xC3, 0x0E, 0x18,
+
+	// @714 '|' (1x9)
+	0xBF, 0xFF, 0x80,
+
+	// @717 '}' (4x9)
+	0x60, 0x68, 0x28, 0x28, 0x1D, 0x28, 0x28, 0x68, 0x60,
+
+	// @726 '~' (5x2)
+	0xB8, 0xA2, 0xE0,
+};
+
+// offset, width, height, top, advance
+const pGLYPH Font10AA_Glyphs[] = 
+{
+	{    0,  0,  0,  0,  4},  // ' '
+	{    0,  2,  7,  0,  3},  // '!'
+	{    4,  5,  3,  1,  6},  // '"'
+	{    8,  5,  8,  0,  6},  // '#'
+	{   18,  5,  8,  0,  6},  // '$'
+	{   28,  5,  7,  0,  6},  // '%'
+	{   37,  5,  6,  1,  6},  // '&'
+	{   45,  2,  3,  1,  3},  // '\''
+	{   47,  2,  9,  0,  3},  // '('
+	{   52,  2,  9,  0,  3},  // ')'
+	{   57,  5,  5,  0,  6},  // '*'
+	{   64,  5,  6,  1,  6},  // '+'
+	{   72,  3,  4,  5,  4},  // ','
+	{   75,  5,  2,  3,  6},  // '-'
+	{   78,  2,  2,  5,  3},  // '.'
+	{   79,  5,  8,  0,  6},  // '/'
+	{   89,  5,  7,  0,  6},  // '0'
+	{   98,  5,  7,  0,  6},  // '1'
+	{  107,  5,  7,  0,  6},  // '2'
+	{  116,  6,  7,  0,  7},  // '3'
+	{  127,  5,  7,  0,  6},  // '4'
+	{  136,  5,  7,  0,  6},  // '5'
+	{  145,  5,  7,  0,  6},  // '6'
+	{  154,  5,  7,  0,  6},  // '7'
+	{  163,  5,  7,  0,  6},  // '8'
+	{  172,  5,  7,  0,  6},  // '9'
+	{  181,  2,  5,  2,  3},  // ':'
+	{  184,  3,  6,  2,  4},  // ';'
+	{  189,  6,  6,  1,  7},  // '<'
+	{  198,  6,  4,  2,  7},  // '='
+	{  204,  6,  6,  1,  7},  // '>'
+	{  213,  5,  6,  1,  6},  // '?'
+	{  221,  4,  8,  0,  5},  // '@'
+	{  229,  7,  6,  1,  8},  // 'A'
+	{  240,  5,  6,  1,  6},  // 'B'
+	{  248,  5,  6,  1,  6},  // 'C'
+	{  256,  6,  6,  1,  7},  // 'D'
+	{  265,  5,  6,  1,  6},  // 'E'
+	{  273,  5,  6,  1,  6},  // 'F'
+	{  281,  6,  6,  1,  7},  // 'G'
+	{  290,  5,  6,  1,  6},  // 'H'
+	{  298,  5,  6,  1,  6},  // 'I'
+	{  306,  6,  6,  1,  7},  // 'J'
+	{  315,  6,  6,  1,  7},  // 'K'
+	{  324,  5,  6,  1,  6},  // 'L'
+	{  332,  7,  6,  1,  8},  // 'M'
+	{  343,  5,  6,  1,  6},  // 'N'
+	{  351,  5,  6,  1,  6},  // 'O'
+	{  359,  5,  6,  1,  6},  // 'P'
+	{  367,  5,  8,  1,  6},  // 'Q'
+	{  377,  6,  6,  1,  7},  // 'R'
+	{  386,  5,  6,  1,  6},  // 'S'
+	{  394,  5,  6,  1,  6},  // 'T'
+	{  402,  5,  6,  1,  6},  // 'U'
+	{  410,  6,  6,  1,  7},  // 'V'
+	{  419,  7,  6,  1,  8},  // 'W'
+	{  430,  6,  6,  1,  7},  // 'X'
+	{  439,  5,  6,  1,  6},  // 'Y'
+	{  447,  5,  6,  1,  6},  // 'Z'
+	{  455,  2,  9,  0,  3},  // '['
+	{  460,  5,  8,  0,  6},  // '\\'
+	{  470,  2,  9,  0,  3},  // ']'
+	{  475,  5,  4,  0,  6},  // '^'
+	{  480,  7,  1,  9,  8},  // '_'
+	{  482,  3,  2,  0,  4},  // '`'
+	{  484,  5,  5,  2,  6},  // 'a'
+	{  491,  6,  7,  0,  7},  // 'b'
+	{  502,  5,  5,  2,  6},  // 'c'
+	{  509,  6,  7,  0,  7},  // 'd'
+	{  520,  5,  5,  2,  6},  // 'e'
+	{  527,  5,  7,  0,  6},  // 'f'
+	{  536,  6,  7,  2,  7},  // 'g'
+	{  547,  5,  7,  0,  6},  // 'h'
+	{  556,  5,  7,  0,  6},  // 'i'
+	{  565,  4,  9,  0,  5},  // 'j'
+	{  574,  5,  7,  0,  6},  // 'k'
+	{  583,  5,  7,  0,  6},  // 'l'
+	{  592,  7,  5,  2,  8},  // 'm'
+	{  601,  5,  5,  2,  6},  // 'n'
+	{  608,  5,  5,  2,  6},  // 'o'
+	{  615,  6,  7,  2,  7},  // 'p'
+	{  626,  6,  7,  2,  7},  // 'q'
+	{  637,  5,  5,  2,  6},  // 'r'
+	{  644,  5,  5,  2,  6},  // 's'
+	{  651,  5,  6,  1,  6},  // 't'
+	{  659,  5,  5,  2,  6},  // 'u'
+	{  666,  6,  5,  2,  7},  // 'v'
+	{  674,  6,  5,  2,  7},  // 'w'
+	{  682,  5,  5,  2,  6},  // 'x'
+	{  689,  6,  7,  2,  7},  // 'y'
+	{  700,  5,  5,  2,  6},  // 'z'
+	{  707,  3,  9,  0,  4},  // '{'
+	{  714,  1,  9,  0,  2},  // '|'
+	{  717,  4,  9,  0,  5},  // '}'
+	{  726,  5,  2,  3,  6},  // '~'
+};
+
+aFONT Font10AA = {
+  Font10AA_Bitmap,
+  Font10AA_Glyphs,
+  ' ', /* First */
+  '~', /* Last */
+  10, /* Height */
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
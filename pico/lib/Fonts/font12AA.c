@@ -0,0 +1,472 @@
+/**
+  ******************************************************************************
+  * @file    Font12AA.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   Anti-aliased Font12AA, the glyphs of font24.c at half size
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for Courier New 12pt, anti-aliased, 2 bits of coverage per pixel
+// 
+
+const uint8_t Font12AA_Bitmap[] = 
+{
+	// @0 ' ' (0x0)
+
+	// @0 '!' (2x8)
+	0xEE, 0xEE, 0x94, 0x99,
+
+	// @4 '"' (4x4)
+	0x96, 0xEB, 0x82, 0x82,
+
+	// @8 '#' (6x8)
+	0x2A, 0x82, 0xA8, 0xAA, 0x9A, 0xA9, 0xBB, 0x9B, 0xB9, 0x33, 0x03, 0x30,
+
+	// @20 '$' (5x10)
+	0x05, 0x06, 0xA6, 0xAE, 0x86, 0x2E, 0x54, 0xBB, 0x1E, 0xBD, 0x0A, 0x02,
+	0x80,
+
+	// @33 '%' (6x8)
+	0x2E, 0x0A, 0x28, 0xA2, 0x82, 0xF9, 0x6E, 0xD2, 0x8A, 0x1E, 0xD0, 0x64,
+
+	// @45 '&' (6x7)
+	0x1F, 0xC3, 0x14, 0x24, 0x02, 0xD6, 0xA7, 0xE6, 0xAE, 0x1A, 0x60,
+
+	// @56 '\'' (2x4)
+	0x9E, 0x88,
+
+	// @58 '(' (4x9)
+	0x0A, 0x2C, 0x38, 0xB0, 0xB0, 0xB0, 0x38, 0x2C, 0x0A,
+
+	// @67 ')' (4x9)
+	0xA0, 0x38, 0x2C, 0x0E, 0x0E, 0x0E, 0x2C, 0x38, 0xA0,
+
+	// @76 '*' (6x5)
+	0x0A, 0x06, 0xA9, 0x6F, 0x90, 0xF0, 0x2A, 0x80,
+
+	// @84 '+' (6x6)
+	0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0xA0,
+
+	// @93 ',' (3x4)
+	0x36, 0x89, 0x20,
+
+	// @96 '-' (6x2)
+	0x6A, 0x96, 0xA9,
+
+	// @99 '.' (2x2)
+	0xFA,
+
+	// @100 '/' (6x10)
+	0x00, 0xA0, 0x0D, 0x02, 0x80, 0x24, 0x06, 0x00, 0x90, 0x18, 0x02, 0x80,
+	0x70, 0x0A, 0x00,
+
+	// @115 '0' (6x8)
+	0x1F, 0x43, 0x0C, 0xA0, 0xAA, 0x0A, 0xA0, 0xA6, 0x09, 0x2A, 0x80, 0xA0,
+
+	// @127 '1' (6x8)
+	0x1A, 0x0B, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x6A, 0x96, 0xA9,
+
+	// @139 '2' (6x8)
+	0x6F, 0x8D, 0x09, 0x80, 0xA0, 0x18, 0x0A, 0x02, 0x40, 0xAA, 0x9A, 0xA9,
+
+	// @151 '3' (6x8)
+	0x2F, 0x42, 0x1C, 0x01, 0x80, 0xF4, 0x01, 0x90, 0x0A, 0xAA, 0xD2, 0xA0,
+
+	// @163 '4' (6x8)
+	0x07, 0x80, 0xA8, 0x2A, 0x83, 0x28, 0x92, 0x8F, 0xFE, 0x0A, 0x90, 0xA9,
+
+	// @175 '5' (6x8)
+	0xBF, 0xCA, 0x00, 0xAA, 0x0B, 0xAC, 0x00, 0xA0, 0x0A, 0xEA, 0xC2, 0xA0,
+
+	// @187 '6' (6x8)
+	0x0B, 0xE2, 0x80, 0x60, 0x0A, 0xF8, 0xA0, 0x9A, 0x0A, 0x3A, 0xD0, 0xA4,
+
+	// @199 '7' (6x8)
+	0xBF, 0xEA, 0x0A, 0x00, 0xC0, 0x28, 0x02, 0x80, 0x30, 0x0A, 0x00, 0x50,
+
+	// @211 '8' (6x8)
+	0x2F, 0x8A, 0x0A, 0x60, 0x92, 0xF8, 0x60, 0x9A, 0x0A, 0x7A, 0xD1, 0xA4,
+
+	// @223 '9' (6x8)
+	0x2F, 0x8A, 0x09, 0xA0, 0xA3, 0xAE, 0x0A, 0xA0, 0x1C, 0x6B, 0x46, 0x80,
+
+	// @235 ':' (2x6)
+	0xFA, 0x00, 0xFA,
+
+	// @238 ';' (3x7)
+	0x3C, 0xA0, 0x09, 0xA2, 0x44, 0x00,
+
+	// @244 '<' (7x7)
+	0x00, 0x2C, 0x0B, 0x82, 0xE0, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x01,
+	0x80,
+
+	// @257 '=' (7x4)
+	0x6A, 0xA9, 0xAA, 0xA6, 0xAA, 0x9A, 0xAA,
+
+	// @264 '>' (8x7)
+	0xB4, 0x00, 0x1A, 0x40, 0x01, 0xA4, 0x00, 0x69, 0x06, 0x90, 0x69, 0x00,
+	0x60, 0x00,
+
+	// @278 '?' (5x8)
+	0x1A, 0x1A, 0xAA, 0x0C, 0x0A, 0x0E, 0x02, 0x01, 0x80, 0x60,
+
+	// @288 '@' (6x9)
+	0x1F, 0x83, 0x4A, 0xA2, 0xEA, 0xAA, 0xAA, 0xAA, 0x2E, 0x60, 0x02, 0xAA,
+	0x0A, 0x40,
+
+	// @302 'A' (8x8)
+	0x1A, 0x40, 0x1A, 0xC0, 0x03, 0xA0, 0x0A, 0x30, 0x0E, 0xB4, 0x2A, 0xA8,
+	0xB8, 0x6E, 0xA8, 0x6A,
+
+	// @318 'B' (7x8)
+	0x6A, 0x91, 0xAA, 0xD2, 0x82, 0x8A, 0xAD, 0x2A, 0xA8, 0xA0, 0x36, 0xAA,
+	0x9A, 0xA8,
+
+	// @332 'C' (6x8)
+	0x0A, 0x67, 0xAB, 0x90, 0x3C, 0x00, 0xC0, 0x09, 0x02, 0x7A, 0xA0, 0xA8,
+
+	// @344 'D' (7x8)
+	0x6A, 0x81, 0xAA, 0xD2, 0x81, 0x8A, 0x03, 0x28, 0x0C, 0xA0, 0x66, 0xAB,
+	0x5A, 0xA4,
+
+	// @358 'E' (7x8)
+	0x6A, 0xA5, 0xAA, 0xA2, 0x96, 0x8A, 0xA0, 0x2A, 0x80, 0xA5, 0xA6, 0xAA,
+	0x9A, 0xA9,
+
+	// @372 'F' (6x8)
+	0xAA, 0xAB, 0xAB, 0x32, 0x33, 0xB0, 0x3B, 0x03, 0x20, 0xBA, 0x0A, 0xA0,
+
+	// @384 'G' (7x8)
+	0x0A, 0x61, 0xEA, 0xC9, 0x03, 0x30, 0x00, 0xC3, 0xFB, 0x40, 0xC7, 0xAB,
+	0x02, 0xA0,
+
+	// @398 'H' (8x8)
+	0x69, 0x69, 0x69, 0x69, 0x28, 0x28, 0x2A, 0xA8, 0x2A, 0xA8, 0x28, 0x28,
+	0x69, 0x69, 0x69, 0x69,
+
+	// @414 'I' (6x8)
+	0x6A, 0x96, 0xA9, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x6A, 0x96, 0xA9,
+
+	// @426 'J' (7x8)
+	0x1A, 0xA4, 0x6B, 0x90, 0x0C, 0x00, 0x30, 0xC0, 0xC3, 0x03, 0x0E, 0xA8,
+	0x0A, 0x40,
+
+	// @440 'K' (8x8)
+	0x6A, 0x29, 0x6A, 0x39, 0x28, 0x90, 0x2A, 0x80, 0x2E, 0xD0, 0x28, 0x70,
+	0x6A, 0x2A, 0x6A, 0x1A,
+
+	// @456 'L' (7x8)
+	0x6A, 0x41, 0xB9, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x08, 0x30, 0x36, 0xEA,
+	0xDA, 0xAA,
+
+	// @470 'M' (8x8)
+	0xA0, 0x0A, 0xB8, 0x2E, 0x3C, 0x3C, 0x3A, 0xAC, 0x33, 0xCC, 0x31, 0x4C,
+	0xB9, 0x6E, 0xA9, 0x6A,
+
+	// @486 'N' (8x8)
+	0x64, 0xA9, 0x68, 0xA9, 0x2E, 0x28, 0x2B, 0x68, 0x29, 0xE8, 0x28, 0xB8,
+	0x6A, 0x28, 0x6A, 0x14,
+
+	// @502 'O' (6x8)
+	0x0A, 0x07, 0xAD, 0xA0, 0xAC, 0x03, 0xC0, 0x3A, 0x0A, 0x7A, 0xD0, 0xA0,
+
+	// @514 'P' (6x8)
+	0xAA, 0x8B, 0xAA, 0x30, 0x33, 0x06, 0x3F, 0x93, 0x00, 0xBA, 0x0A, 0xA0,
+
+	// @526 'Q' (6x9)
+	0x0A, 0x07, 0xAD, 0xA0, 0xAC, 0x03, 0xC0, 0x3A, 0x0A, 0x7A, 0xD2, 0xF2,
+	0x3A, 0xE0,
+
+	// @540 'R' (8x8)
+	0x6A, 0x90, 0x6A, 0xB4, 0x28, 0x28, 0x2A, 0xB4, 0x2A, 0xD0, 0x28, 0x70,
+	0x6A, 0x29, 0x6A, 0x09,
+
+	// @556 'S' (6x8)
+	0x1A, 0x57, 0xAE, 0xA0, 0xA7, 0xA0, 0x0A, 0xDA, 0x0A, 0xBA, 0xD5, 0xA4,
+
+	// @568 'T' (6x8)
+	0xAA, 0xAE, 0xAB, 0xCA, 0x38, 0xA2, 0x0A, 0x00, 0xA0, 0x2A, 0x82, 0xA8,
+
+	// @580 'U' (8x8)
+	0x69, 0x69, 0x69, 0x69, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x0E, 0xB0, 0x02, 0x80,
+
+	// @596 'V' (8x8)
+	0x6A, 0x6A, 0x6A, 0x6E, 0x0C, 0x28, 0x09, 0x24, 0x06, 0x60, 0x03, 0xA0,
+	0x02, 0xC0, 0x00, 0x40,
+
+	// @612 'W' (9x8)
+	0xA9, 0x2A, 0x6E, 0x4A, 0x93, 0x04, 0xA0, 0xAB, 0x30, 0x2B, 0xAC, 0x07,
+	0x9E, 0x00, 0xD2, 0x80, 0x20, 0x50,
+
+	// @630 'X' (8x8)
+	0x69, 0x69, 0x69, 0x69, 0x09, 0x60, 0x02, 0x80, 0x02, 0x80, 0x09, 0x60,
+	0x69, 0x69, 0x69, 0x69,
+
+	// @646 'Y' (8x8)
+	0x68, 0x69, 0x68, 0x69, 0x09, 0x60, 0x06, 0x90, 0x02, 0x80, 0x02, 0x80,
+	0x0A, 0xA0, 0x0A, 0xA0,
+
+	// @662 'Z' (6x8)
+	0x6A, 0x9A, 0xAA, 0xA1, 0x85, 0x60, 0x18, 0x56, 0x0A, 0xEA, 0xAA, 0xA9,
+
+	// @674 '[' (3x9)
+	0xBE, 0x8A, 0x28, 0xA2, 0x8A, 0x28, 0xBC,
+
+	// @681 '\\' (6x10)
+	0xA0, 0x07, 0x00, 0x28, 0x01, 0x80, 0x09, 0x00, 0x60, 0x02, 0x40, 0x28,
+	0x00, 0xD0, 0x0A,
+
+	// @696 ']' (3x9)
+	0xF8, 0xA2, 0x8A, 0x28, 0xA2, 0x8A, 0xF8,
+
+	// @703 '^' (6x5)
+	0x01, 0x00, 0xB4, 0x29, 0xC6, 0x06, 0x40, 0x10,
+
+	// @711 '_' (8x1)
+	0xFF, 0xFF,
+
+	// @713 '`' (3x3)
+	0x82, 0x91, 0x40,
+
+	// @716 'a' (6x6)
+	0x7F, 0x40, 0x0C, 0x6F, 0xCD, 0x0C, 0xAA, 0xE2, 0x9A,
+
+	// @725 'b' (7x8)
+	0xB8, 0x00, 0xA0, 0x02, 0xBE, 0x4A, 0x06, 0x28, 0x0C, 0xA0, 0x36, 0xEA,
+	0x99, 0xA4,
+
+	// @739 'c' (6x6)
+	0x2F, 0xBA, 0x07, 0xC0, 0x2D, 0x02, 0x7A, 0xA0, 0xA8,
+
+	// @748 'd' (7x8)
+	0x02, 0xE0, 0x02, 0x86, 0xFA, 0x24, 0x28, 0xC0, 0xA3, 0x02, 0x8A, 0xAE,
+	0x46, 0x99,
+
+	// @762 'e' (6x6)
+	0x6F, 0x99, 0x06, 0xFF, 0xFC, 0x00, 0xAA, 0xB1, 0xA8,
+
+	// @771 'f' (6x8)
+	0x0B, 0xF2, 0x80, 0xFF, 0xE2, 0x80, 0x28, 0x02, 0x80, 0xAA, 0x8A, 0xA8,
+
+	// @783 'g' (7x8)
+	0x6F, 0xBA, 0x42, 0x8C, 0x0A, 0x30, 0x28, 0xAA, 0xE0, 0x6A, 0x80, 0x0A,
+	0x0F, 0xE0,
+
+	// @797 'h' (8x8)
+	0xB8, 0x00, 0x28, 0x00, 0x2B, 0xE0, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x69, 0x69, 0x69, 0x69,
+
+	// @813 'i' (6x8)
+	0x0A, 0x00, 0x00, 0xBE, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+
+	// @825 'j' (5x10)
+	0x03, 0x00, 0x0B, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0xEF,
+	0x90,
+
+	// @838 'k' (6x8)
+	0xF0, 0x03, 0x00, 0x33, 0xE3, 0x60, 0x3D, 0x03, 0xA0, 0xB2, 0xAA, 0x1A,
+
+	// @850 'l' (6x8)
+	0xBE, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+
+	// @862 'm' (8x6)
+	0xFB, 0xB8, 0x36, 0x8C, 0x32, 0x8C, 0x32, 0x8C, 0xBA, 0x9E, 0xA9, 0x9A,
+
+	// @874 'n' (8x6)
+	0xBB, 0xE0, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x69, 0x69, 0x69, 0x69,
+
+	// @886 'o' (6x6)
+	0x2F, 0x8A, 0x0A, 0xC0, 0x3D, 0x07, 0x7A, 0xD0, 0xA0,
+
+	// @895 'p' (7x8)
+	0xBB, 0xE4, 0xA0, 0x62, 0x80, 0xCA, 0x03, 0x2E, 0xA8, 0xAA, 0x42, 0x80,
+	0x2F, 0xC0,
+
+	// @909 'q' (7x8)
+	0x6F, 0xBA, 0x42, 0x8C, 0x0A, 0x30, 0x28, 0xAA, 0xE0, 0x6A, 0x80, 0x0A,
+	0x00, 0xFE,
+
+	// @923 'r' (6x6)
+	0xFA, 0xE2, 0xE2, 0x28, 0x02, 0x80, 0xAA, 0x8A, 0xA8,
+
+	// @932 's' (6x6)
+	0x2F, 0xEA, 0x0A, 0x7E, 0x85, 0x2A, 0xAA, 0xD6, 0xA4,
+
+	// @941 't' (6x8)
+	0x30, 0x03, 0x00, 0xFF, 0xC3, 0x00, 0x30, 0x03, 0x00, 0x2A, 0xB0, 0xA8,
+
+	// @953 'u' (8x6)
+	0xB8, 0xB8, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x1A, 0xB9, 0x06, 0x99,
+
+	// @965 'v' (8x6)
+	0xBC, 0x3E, 0x28, 0x28, 0x0C, 0x30, 0x0A, 0xA0, 0x07, 0xD0, 0x02, 0x80,
+
+	// @977 'w' (7x6)
+	0xB8, 0x3C, 0xC9, 0xA2, 0x6A, 0x4B, 0xBC, 0x1C, 0xA0, 0x21, 0x40,
+
+	// @988 'x' (6x6)
+	0xFA, 0xF2, 0x58, 0x0A, 0x01, 0xA4, 0xB5, 0xEA, 0x5A,
+
+	// @997 'y' (8x8)
+	0xBE, 0x2F, 0x18, 0x18, 0x09, 0x24, 0x06, 0x60, 0x02, 0xD0, 0x01, 0x80,
+	0x02, 0x40, 0x3F, 0xC0,
+
+	// @1013 'z' (6x6)
+	0xBF, 0xEA, 0x18, 0x06, 0x01, 0x85, 0x7A, 0xA6, 0xA9,
+
+	// @1022 '{' (4x9)
+	0x1E, 0x28, 0x28, 0x28, 0x74, 0x28, 0x28, 0x28, 0x1E,
+
+	// @1031 '|' (2x9)
+	0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
+
+	// @1036 '}' (4x9)
+	0xB4, 0x28, 0x28, 0x28, 0x1D, 0x28, 0x28, 0x28, 0xB4,
+
+	// @1045 '~' (6x3)
+	0x78, 0x5D, 0xAD, 0x02, 0x40,
+};
+
+// offset, width, height, top, advance
+const pGLYPH Font12AA_Glyphs[] = 
+{
+	{    0,  0,  0,  0,  5},  // ' '
+	{    0,  2,  8,  1,  3},  // '!'
+	{    4,  4,  4,  1,  5},  // '"'
+	{    8,  6,  8,  1,  7},  // '#'
+	{   20,  5, 10,  0,  6},  // '$'
+	{   33,  6,  8,  1,  7},  // '%'
+	{   45,  6,  7,  2,  7},  // '&'
+	{   56,  2,  4,  1,  3},  // '\''
+	{   58,  4,  9,  1,  5},  // '('
+	{   67,  4,  9,  1,  5},  // ')'
+	{   76,  6,  5,  1,  7},  // '*'
+	{   84,  6,  6,  2,  7},  // '+'
+	{   93,  3,  4,  7,  4},  // ','
+	{   96,  6,  2,  4,  7},  // '-'
+	{   99,  2,  2,  7,  3},  // '.'
+	{  100,  6, 10,  0,  7},  // '/'
+	{  115,  6,  8,  1,  7},  // '0'
+	{  127,  6,  8,  1,  7},  // '1'
+	{  139,  6,  8,  1,  7},  // '2'
+	{  151,  6,  8,  1,  7},  // '3'
+	{  163,  6,  8,  1,  7},  // '4'
+	{  175,  6,  8,  1,  7},  // '5'
+	{  187,  6,  8,  1,  7},  // '6'
+	{  199,  6,  8,  1,  7},  // '7'
+	{  211,  6,  8,  1,  7},  // '8'
+	{  223,  6,  8,  1,  7},  // '9'
+	{  235,  2,  6,  3,  3},  // ':'
+	{  238,  3,  7,  3,  4},  // ';'
+	{  244,  7,  7,  2,  8},  // '<'
+	{  257,  7,  4,  3,  8},  // '='
+	{  264,  8,  7,  2,  9},  // '>'
+	{  278,  5,  8,  1,  6},  // '?'
+	{  288,  6,  9,  1,  7},  // '@'
+	{  302,  8,  8,  1,  9},  // 'A'
+	{  318,  7,  8,  1,  8},  // 'B'
+	{  332,  6,  8,  1,  7},  // 'C'
+	{  344,  7,  8,  1,  8},  // 'D'
+	{  358,  7,  8,  1,  8},  // 'E'
+	{  372,  6,  8,  1,  7},  // 'F'
+	{  384,  7,  8,  1,  8},  // 'G'
+	{  398,  8,  8,  1,  9},  // 'H'
+	{  414,  6,  8,  1,  7},  // 'I'
+	{  426,  7,  8,  1,  8},  // 'J'
+	{  440,  8,  8,  1,  9},  // 'K'
+	{  456,  7,  8,  1,  8},  // 'L'
+	{  470,  8,  8,  1,  9},  // 'M'
+	{  486,  8,  8,  1,  9},  // 'N'
+	{  502,  6,  8,  1,  7},  // 'O'
+	{  514,  6,  8,  1,  7},  // 'P'
+	{  526,  6,  9,  1,  7},  // 'Q'
+	{  540,  8,  8,  1,  9},  // 'R'
+	{  556,  6,  8,  1,  7},  // 'S'
+	{  568,  6,  8,  1,  7},  // 'T'
+	{  580,  8,  8,  1,  9},  // 'U'
+	{  596,  8,  8,  1,  9},  // 'V'
+	{  612,  9,  8,  1, 10},  // 'W'
+	{  630,  8,  8,  1,  9},  // 'X'
+	{  646,  8,  8,  1,  9},  // 'Y'
+	{  662,  6,  8,  1,  7},  // 'Z'
+	{  674,  3,  9,  1,  4},  // '['
+	{  681,  6, 10,  0,  7},  // '\\'
+	{  696,  3,  9,  1,  4},  // ']'
+	{  703,  6,  5,  0,  7},  // '^'
+	{  711,  8,  1, 11,  9},  // '_'
+	{  713,  3,  3,  0,  4},  // '`'
+	{  716,  6,  6,  3,  7},  // 'a'
+	{  725,  7,  8,  1,  8},  // 'b'
+	{  739,  6,  6,  3,  7},  // 'c'
+	{  748,  7,  8,  1,  8},  // 'd'
+	{  762,  6,  6,  3,  7},  // 'e'
+	{  771,  6,  8,  1,  7},  // 'f'
+	{  783,  7,  8,  3,  8},  // 'g'
+	{  797,  8,  8,  1,  9},  // 'h'
+	{  813,  6,  8,  1,  7},  // 'i'
+	{  825,  5, 10,  1,  6},  // 'j'
+	{  838,  6,  8,  1,  7},  // 'k'
+	{  850,  6,  8,  1,  7},  // 'l'
+	{  862,  8,  6,  3,  9},  // 'm'
+	{  874,  8,  6,  3,  9},  // 'n'
+	{  886,  6,  6,  3,  7},  // 'o'
+	{  895,  7,  8,  3,  8},  // 'p'
+	{  909,  7,  8,  3,  8},  // 'q'
+	{  923,  6,  6,  3,  7},  // 'r'
+	{  932,  6,  6,  3,  7},  // 's'
+	{  941,  6,  8,  1,  7},  // 't'
+	{  953,  8,  6,  3,  9},  // 'u'
+	{  965,  8,  6,  3,  9},  // 'v'
+	{  977,  7,  6,  3,  8},  // 'w'
+	{  988,  6,  6,  3,  7},  // 'x'
+	{  997,  8,  8,  3,  9},  // 'y'
+	{ 1013,  6,  6,  3,  7},  // 'z'
+	{ 1022,  4,  9,  1,  5},  // '{'
+	{ 1031,  2,  9,  1,  3},  // '|'
+	{ 1036,  4,  9,  1,  5},  // '}'
+	{ 1045,  6,  3,  4,  7},  // '~'
+};
+
+aFONT Font12AA = {
+  Font12AA_Bitmap,
+  Font12AA_Glyphs,
+  ' ', /* First */
+  '~', /* Last */
+  12, /* Height */
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
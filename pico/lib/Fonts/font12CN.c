@@ -109,12 +109,42 @@ const CH_CN Font12CN_Table[] =
 0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}},
 };
 
+// GB2312 codes of the table, sorted by code, see Paint_DrawString_CN
+const CH_CN_CODE Font12CN_GB2312[] = 
+{
+  {0x0041,  8},  /* A */
+  {0x0061,  5},  /* a */
+  {0x0062,  6},  /* b */
+  {0x0063,  7},  /* c */
+  {0xBAC3,  1},  /*  */
+  {0xC4E3,  0},  /*  */
+  {0xC5C9,  4},  /*  */
+  {0xCAF7,  2},  /*  */
+  {0xDDAE,  3},  /* ݮ */
+};
+
+// Unicode code points of the table, sorted by code, see Paint_DrawString_CN
+const CH_CN_CODE Font12CN_Unicode[] = 
+{
+  {0x0041,  8},  /* A */
+  {0x0061,  5},  /* a */
+  {0x0062,  6},  /* b */
+  {0x0063,  7},  /* c */
+  {0x4F60,  0},  /*  */
+  {0x597D,  1},  /*  */
+  {0x6811,  2},  /*  */
+  {0x6D3E,  4},  /*  */
+  {0x8393,  3},  /* ݮ */
+};
+
 cFONT Font12CN = {
   Font12CN_Table,
   sizeof(Font12CN_Table)/sizeof(CH_CN),  /*size of table*/
   11, /* ASCII Width */
   16, /* Width */
   21, /* Height */
+  Font12CN_GB2312, /* GB2312 index */
+  Font12CN_Unicode, /* Unicode index */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
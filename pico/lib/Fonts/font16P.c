@@ -0,0 +1,446 @@
+/**
+  ******************************************************************************
+  * @file    Font16P.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   Proportional Font16, the glyphs of font16.c cut to their ink
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for Courier New 12pt, proportional, rows of the glyph box bit packed
+// 
+
+const uint8_t Font16P_Bitmap[] = 
+{
+	// @0 ' ' (0x0)
+
+	// @0 '!' (2x10)
+	0xFF, 0xFF, 0x30,
+
+	// @3 '"' (7x5)
+	0xEF, 0xDD, 0x12, 0x24, 0x40,
+
+	// @8 '#' (8x11)
+	0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C,
+
+	// @19 '$' (7x13)
+	0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00,
+
+	// @31 '%' (8x10)
+	0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06,
+
+	// @41 '&' (7x9)
+	0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76,
+
+	// @49 '\'' (3x5)
+	0xFD, 0x24,
+
+	// @51 '(' (4x12)
+	0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33,
+
+	// @57 ')' (4x12)
+	0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC,
+
+	// @63 '*' (8x7)
+	0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66,
+
+	// @70 '+' (7x7)
+	0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+
+	// @77 ',' (3x5)
+	0x6B, 0x48,
+
+	// @79 '-' (7x1)
+	0xFE,
+
+	// @80 '.' (2x2)
+	0xF0,
+
+	// @81 '/' (8x13)
+	0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0,
+	0xC0,
+
+	// @94 '0' (7x10)
+	0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70,
+
+	// @103 '1' (8x10)
+	0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+
+	// @113 '2' (7x10)
+	0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC,
+
+	// @122 '3' (8x10)
+	0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+
+	// @132 '4' (7x10)
+	0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C,
+
+	// @141 '5' (7x10)
+	0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8,
+
+	// @150 '6' (7x10)
+	0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78,
+
+	// @159 '7' (7x10)
+	0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,
+
+	// @168 '8' (7x10)
+	0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8,
+
+	// @177 '9' (7x10)
+	0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0,
+
+	// @186 ':' (2x7)
+	0xF0, 0x3C,
+
+	// @188 ';' (4x9)
+	0x33, 0x00, 0x06, 0x48, 0x80,
+
+	// @193 '<' (9x9)
+	0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80,
+
+	// @204 '=' (9x3)
+	0xFF, 0x80, 0x3F, 0xE0,
+
+	// @208 '>' (9x9)
+	0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x00,
+
+	// @219 '?' (7x9)
+	0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30,
+
+	// @227 '@' (6x11)
+	0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80,
+
+	// @236 'A' (10x9)
+	0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0,
+
+	// @248 'B' (8x9)
+	0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE,
+
+	// @257 'C' (9x9)
+	0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00,
+
+	// @268 'D' (9x9)
+	0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00,
+
+	// @279 'E' (8x9)
+	0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,
+
+	// @288 'F' (9x9)
+	0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00,
+
+	// @299 'G' (9x9)
+	0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00,
+
+	// @310 'H' (9x9)
+	0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80,
+
+	// @321 'I' (8x9)
+	0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+
+	// @330 'J' (9x9)
+	0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00,
+
+	// @341 'K' (9x9)
+	0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80,
+
+	// @352 'L' (9x9)
+	0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80,
+
+	// @363 'M' (11x9)
+	0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB,
+	0xE0,
+
+	// @376 'N' (9x9)
+	0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00,
+
+	// @387 'O' (9x9)
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00,
+
+	// @398 'P' (8x9)
+	0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC,
+
+	// @407 'Q' (9x11)
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF,
+	0xC0,
+
+	// @420 'R' (10x9)
+	0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0,
+
+	// @432 'S' (7x9)
+	0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC,
+
+	// @440 'T' (8x9)
+	0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E,
+
+	// @449 'U' (9x9)
+	0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00,
+
+	// @460 'V' (9x9)
+	0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00,
+
+	// @471 'W' (11x9)
+	0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31,
+	0x80,
+
+	// @484 'X' (9x9)
+	0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80,
+
+	// @495 'Y' (10x9)
+	0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00,
+
+	// @507 'Z' (7x9)
+	0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE,
+
+	// @515 '[' (4x12)
+	0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF,
+
+	// @521 '\\' (8x13)
+	0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03,
+	0x03,
+
+	// @534 ']' (4x12)
+	0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,
+
+	// @540 '^' (7x6)
+	0x10, 0x50, 0xA2, 0x28, 0x30, 0x40,
+
+	// @546 '_' (11x1)
+	0xFF, 0xE0,
+
+	// @548 '`' (3x3)
+	0x88, 0x80,
+
+	// @550 'a' (8x7)
+	0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77,
+
+	// @557 'b' (9x10)
+	0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77, 0x00,
+
+	// @569 'c' (8x7)
+	0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E,
+
+	// @576 'd' (9x10)
+	0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0,
+
+	// @588 'e' (9x7)
+	0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC,
+
+	// @596 'f' (9x10)
+	0x1F, 0x98, 0x0C, 0x1F, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00,
+
+	// @608 'g' (9x10)
+	0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00,
+
+	// @620 'h' (9x10)
+	0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0,
+
+	// @632 'i' (8x10)
+	0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+
+	// @642 'j' (6x13)
+	0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8,
+
+	// @652 'k' (9x10)
+	0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0,
+
+	// @664 'l' (8x10)
+	0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+
+	// @674 'm' (10x7)
+	0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC,
+
+	// @683 'n' (9x7)
+	0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE,
+
+	// @691 'o' (9x7)
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8,
+
+	// @699 'p' (9x10)
+	0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00,
+
+	// @711 'q' (9x10)
+	0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0,
+
+	// @723 'r' (9x7)
+	0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8,
+
+	// @731 's' (7x7)
+	0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00,
+
+	// @738 't' (8x10)
+	0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E,
+
+	// @748 'u' (9x7)
+	0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE,
+
+	// @756 'v' (9x7)
+	0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70,
+
+	// @764 'w' (11x7)
+	0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60,
+
+	// @774 'x' (9x7)
+	0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE,
+
+	// @782 'y' (10x10)
+	0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F,
+	0x00,
+
+	// @795 'z' (7x7)
+	0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80,
+
+	// @802 '{' (4x12)
+	0x36, 0x66, 0x66, 0xC6, 0x66, 0x63,
+
+	// @808 '|' (2x12)
+	0xFF, 0xFF, 0xFF,
+
+	// @811 '}' (4x12)
+	0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C,
+
+	// @817 '~' (7x3)
+	0x61, 0x24, 0x30,
+};
+
+// offset, width, height, top, advance
+const pGLYPH Font16P_Glyphs[] = 
+{
+	{    0,  0,  0,  0,  6},  // ' '
+	{    0,  2, 10,  1,  4},  // '!'
+	{    3,  7,  5,  2,  9},  // '"'
+	{    8,  8, 11,  1, 10},  // '#'
+	{   19,  7, 13,  0,  9},  // '$'
+	{   31,  8, 10,  1, 10},  // '%'
+	{   41,  7,  9,  2,  9},  // '&'
+	{   49,  3,  5,  2,  5},  // '\''
+	{   51,  4, 12,  1,  6},  // '('
+	{   57,  4, 12,  1,  6},  // ')'
+	{   63,  8,  7,  1, 10},  // '*'
+	{   70,  7,  7,  3,  9},  // '+'
+	{   77,  3,  5,  9,  5},  // ','
+	{   79,  7,  1,  6,  9},  // '-'
+	{   80,  2,  2,  9,  4},  // '.'
+	{   81,  8, 13,  0, 10},  // '/'
+	{   94,  7, 10,  1,  9},  // '0'
+	{  103,  8, 10,  1, 10},  // '1'
+	{  113,  7, 10,  1,  9},  // '2'
+	{  122,  8, 10,  1, 10},  // '3'
+	{  132,  7, 10,  1,  9},  // '4'
+	{  141,  7, 10,  1,  9},  // '5'
+	{  150,  7, 10,  1,  9},  // '6'
+	{  159,  7, 10,  1,  9},  // '7'
+	{  168,  7, 10,  1,  9},  // '8'
+	{  177,  7, 10,  1,  9},  // '9'
+	{  186,  2,  7,  4,  4},  // ':'
+	{  188,  4,  9,  4,  6},  // ';'
+	{  193,  9,  9,  2, 11},  // '<'
+	{  204,  9,  3,  5, 11},  // '='
+	{  208,  9,  9,  2, 11},  // '>'
+	{  219,  7,  9,  2,  9},  // '?'
+	{  227,  6, 11,  1,  8},  // '@'
+	{  236, 10,  9,  2, 12},  // 'A'
+	{  248,  8,  9,  2, 10},  // 'B'
+	{  257,  9,  9,  2, 11},  // 'C'
+	{  268,  9,  9,  2, 11},  // 'D'
+	{  279,  8,  9,  2, 10},  // 'E'
+	{  288,  9,  9,  2, 11},  // 'F'
+	{  299,  9,  9,  2, 11},  // 'G'
+	{  310,  9,  9,  2, 11},  // 'H'
+	{  321,  8,  9,  2, 10},  // 'I'
+	{  330,  9,  9,  2, 11},  // 'J'
+	{  341,  9,  9,  2, 11},  // 'K'
+	{  352,  9,  9,  2, 11},  // 'L'
+	{  363, 11,  9,  2, 13},  // 'M'
+	{  376,  9,  9,  2, 11},  // 'N'
+	{  387,  9,  9,  2, 11},  // 'O'
+	{  398,  8,  9,  2, 10},  // 'P'
+	{  407,  9, 11,  2, 11},  // 'Q'
+	{  420, 10,  9,  2, 12},  // 'R'
+	{  432,  7,  9,  2,  9},  // 'S'
+	{  440,  8,  9,  2, 10},  // 'T'
+	{  449,  9,  9,  2, 11},  // 'U'
+	{  460,  9,  9,  2, 11},  // 'V'
+	{  471, 11,  9,  2, 13},  // 'W'
+	{  484,  9,  9,  2, 11},  // 'X'
+	{  495, 10,  9,  2, 12},  // 'Y'
+	{  507,  7,  9,  2,  9},  // 'Z'
+	{  515,  4, 12,  1,  6},  // '['
+	{  521,  8, 13,  0, 10},  // '\\'
+	{  534,  4, 12,  1,  6},  // ']'
+	{  540,  7,  6,  0,  9},  // '^'
+	{  546, 11,  1, 15, 13},  // '_'
+	{  548,  3,  3,  0,  5},  // '`'
+	{  550,  8,  7,  4, 10},  // 'a'
+	{  557,  9, 10,  1, 11},  // 'b'
+	{  569,  8,  7,  4, 10},  // 'c'
+	{  576,  9, 10,  1, 11},  // 'd'
+	{  588,  9,  7,  4, 11},  // 'e'
+	{  596,  9, 10,  1, 11},  // 'f'
+	{  608,  9, 10,  4, 11},  // 'g'
+	{  620,  9, 10,  1, 11},  // 'h'
+	{  632,  8, 10,  1, 10},  // 'i'
+	{  642,  6, 13,  1,  8},  // 'j'
+	{  652,  9, 10,  1, 11},  // 'k'
+	{  664,  8, 10,  1, 10},  // 'l'
+	{  674, 10,  7,  4, 12},  // 'm'
+	{  683,  9,  7,  4, 11},  // 'n'
+	{  691,  9,  7,  4, 11},  // 'o'
+	{  699,  9, 10,  4, 11},  // 'p'
+	{  711,  9, 10,  4, 11},  // 'q'
+	{  723,  9,  7,  4, 11},  // 'r'
+	{  731,  7,  7,  4,  9},  // 's'
+	{  738,  8, 10,  1, 10},  // 't'
+	{  748,  9,  7,  4, 11},  // 'u'
+	{  756,  9,  7,  4, 11},  // 'v'
+	{  764, 11,  7,  4, 13},  // 'w'
+	{  774,  9,  7,  4, 11},  // 'x'
+	{  782, 10, 10,  4, 12},  // 'y'
+	{  795,  7,  7,  4,  9},  // 'z'
+	{  802,  4, 12,  1,  6},  // '{'
+	{  808,  2, 12,  1,  4},  // '|'
+	{  811,  4, 12,  1,  6},  // '}'
+	{  817,  7,  3,  5,  9},  // '~'
+};
+
+pFONT Font16P = {
+  Font16P_Bitmap,
+  Font16P_Glyphs,
+  ' ', /* First */
+  '~', /* Last */
+  16, /* Height */
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
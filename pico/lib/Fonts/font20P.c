@@ -0,0 +1,500 @@
+/**
+  ******************************************************************************
+  * @file    Font20P.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   Proportional Font20, the glyphs of font20.c cut to their ink
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for Courier New 12pt, proportional, rows of the glyph box bit packed
+// 
+
+const uint8_t Font20P_Bitmap[] = 
+{
+	// @0 ' ' (0x0)
+
+	// @0 '!' (3x13)
+	0xFF, 0xFF, 0xFA, 0x40, 0x7E,
+
+	// @5 '"' (8x6)
+	0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42,
+
+	// @11 '#' (10x16)
+	0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F,
+	0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC,
+
+	// @31 '$' (8x16)
+	0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE,
+	0xFC, 0x18, 0x18, 0x18,
+
+	// @47 '%' (9x13)
+	0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42,
+	0x21, 0x10, 0x70,
+
+	// @62 '&' (9x11)
+	0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF,
+	0x60,
+
+	// @75 '\'' (3x6)
+	0xFF, 0xA4, 0x80,
+
+	// @78 '(' (4x16)
+	0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33,
+
+	// @86 ')' (4x16)
+	0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC,
+
+	// @94 '*' (8x9)
+	0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,
+
+	// @103 '+' (10x10)
+	0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03,
+	0x00,
+
+	// @116 ',' (4x6)
+	0x76, 0x6C, 0xC8,
+
+	// @119 '-' (9x2)
+	0xFF, 0xFF, 0xC0,
+
+	// @122 '.' (3x3)
+	0xFF, 0x80,
+
+	// @124 '/' (8x16)
+	0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60,
+	0x60, 0x60, 0xC0, 0xC0,
+
+	// @140 '0' (9x13)
+	0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+	0xCF, 0xE3, 0xE0,
+
+	// @155 '1' (8x13)
+	0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+
+	// @168 '2' (9x13)
+	0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x1F, 0xFF, 0xF8,
+
+	// @183 '3' (10x13)
+	0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0,
+	0x3C, 0x1F, 0xFE, 0x7F, 0x00,
+
+	// @200 '4' (9x13)
+	0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0,
+	0xC1, 0xF0, 0xF8,
+
+	// @215 '5' (9x13)
+	0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0,
+	0xFF, 0xE7, 0xE0,
+
+	// @230 '6' (9x13)
+	0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8,
+	0xEF, 0xE1, 0xE0,
+
+	// @245 '7' (9x13)
+	0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03,
+	0x01, 0x80, 0xC0,
+
+	// @260 '8' (9x13)
+	0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+	0xEF, 0xE3, 0xE0,
+
+	// @275 '9' (9x13)
+	0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83,
+	0xDF, 0xCF, 0x80,
+
+	// @290 ':' (3x9)
+	0xFF, 0x80, 0x3F, 0xE0,
+
+	// @294 ';' (5x11)
+	0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20,
+
+	// @301 '<' (11x11)
+	0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07,
+	0x80, 0x3C, 0x01, 0x80,
+
+	// @317 '=' (11x6)
+	0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
+
+	// @326 '>' (11x11)
+	0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C,
+	0x1E, 0x03, 0x00, 0x00,
+
+	// @342 '?' (8x12)
+	0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38,
+
+	// @354 '@' (7x14)
+	0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27,
+	0x80,
+
+	// @367 'A' (12x12)
+	0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC,
+	0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,
+
+	// @385 'B' (10x12)
+	0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFE,
+
+	// @400 'C' (10x12)
+	0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC,
+	0x73, 0xF8, 0x7C,
+
+	// @415 'D' (11x12)
+	0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60,
+	0xEC, 0x3B, 0xFE, 0x7F, 0x80,
+
+	// @432 'E' (10x12)
+	0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFF,
+
+	// @447 'F' (10x12)
+	0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18,
+	0x0F, 0xC3, 0xF0,
+
+	// @462 'G' (11x12)
+	0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0,
+	0xCC, 0x19, 0xFF, 0x0F, 0x80,
+
+	// @479 'H' (10x12)
+	0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98,
+	0x6F, 0x3F, 0xCF,
+
+	// @494 'I' (8x12)
+	0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,
+
+	// @506 'J' (11x12)
+	0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1,
+	0x98, 0x73, 0xFC, 0x1F, 0x00,
+
+	// @523 'K' (11x12)
+	0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63,
+	0x0C, 0x33, 0xE7, 0xFC, 0x70,
+
+	// @540 'L' (10x12)
+	0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC,
+	0x3F, 0xFF, 0xFF,
+
+	// @555 'M' (12x12)
+	0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66,
+	0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F,
+
+	// @573 'N' (10x12)
+	0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98,
+	0xEF, 0xBB, 0xE6,
+
+	// @588 'O' (10x12)
+	0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+	0xE3, 0xF0, 0x78,
+
+	// @603 'P' (10x12)
+	0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18,
+	0x0F, 0xC3, 0xF0,
+
+	// @618 'Q' (10x15)
+	0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+	0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38,
+
+	// @637 'R' (11x12)
+	0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61,
+	0x8C, 0x3B, 0xE3, 0xFC, 0x30,
+
+	// @654 'S' (10x12)
+	0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8,
+	0x7F, 0xFB, 0x7C,
+
+	// @669 'T' (10x12)
+	0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x03, 0xF0, 0xFC,
+
+	// @684 'U' (10x12)
+	0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C,
+	0xE3, 0xF0, 0x78,
+
+	// @699 'V' (11x12)
+	0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B,
+	0x01, 0xC0, 0x38, 0x07, 0x00,
+
+	// @716 'W' (13x12)
+	0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5,
+	0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0,
+
+	// @736 'X' (11x12)
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31,
+	0x8C, 0x1B, 0xC7, 0xF8, 0xF0,
+
+	// @753 'Y' (10x12)
+	0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+	0x03, 0xF0, 0xFC,
+
+	// @768 'Z' (8x12)
+	0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF,
+
+	// @780 '[' (4x16)
+	0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,
+
+	// @788 '\\' (8x16)
+	0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06,
+	0x06, 0x06, 0x03, 0x03,
+
+	// @804 ']' (4x16)
+	0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,
+
+	// @812 '^' (9x6)
+	0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,
+
+	// @819 '_' (14x2)
+	0xFF, 0xFF, 0xFF, 0xF0,
+
+	// @823 '`' (4x3)
+	0x86, 0x10,
+
+	// @825 'a' (10x9)
+	0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,
+
+	// @837 'b' (11x13)
+	0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60,
+	0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,
+
+	// @855 'c' (10x9)
+	0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,
+
+	// @867 'd' (11x13)
+	0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0,
+	0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE,
+
+	// @885 'e' (10x9)
+	0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x00,
+
+	// @897 'f' (9x13)
+	0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+	0x1F, 0xEF, 0xF0,
+
+	// @912 'g' (11x13)
+	0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+	0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,
+
+	// @930 'h' (10x13)
+	0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98,
+	0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+
+	// @947 'i' (8x13)
+	0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+
+	// @960 'j' (8x17)
+	0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x07, 0xFE, 0xFC,
+
+	// @977 'k' (10x13)
+	0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B,
+	0x06, 0x63, 0x9F, 0xE7, 0xC0,
+
+	// @994 'l' (8x13)
+	0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+
+	// @1007 'm' (12x9)
+	0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77,
+	0xF7, 0x70,
+
+	// @1021 'n' (10x9)
+	0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+
+	// @1033 'o' (10x9)
+	0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,
+
+	// @1045 'p' (11x13)
+	0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F,
+	0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80,
+
+	// @1063 'q' (11x13)
+	0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+	0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E,
+
+	// @1081 'r' (10x9)
+	0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,
+
+	// @1093 's' (8x9)
+	0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC,
+
+	// @1102 't' (10x12)
+	0x30, 0x0C, 0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+	0x33, 0xFC, 0x7C,
+
+	// @1117 'u' (10x9)
+	0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0,
+
+	// @1129 'v' (11x9)
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E,
+	0x00,
+
+	// @1142 'w' (11x9)
+	0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31,
+	0x80,
+
+	// @1155 'x' (10x9)
+	0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,
+
+	// @1167 'y' (11x13)
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C,
+	0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0,
+
+	// @1185 'z' (8x9)
+	0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF,
+
+	// @1194 '{' (6x16)
+	0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7,
+
+	// @1206 '|' (2x16)
+	0xFF, 0xFF, 0xFF, 0xFF,
+
+	// @1210 '}' (6x16)
+	0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,
+
+	// @1222 '~' (10x4)
+	0x38, 0x3F, 0x3C, 0xFC, 0x1E,
+};
+
+// offset, width, height, top, advance
+const pGLYPH Font20P_Glyphs[] = 
+{
+	{    0,  0,  0,  0,  7},  // ' '
+	{    0,  3, 13,  1,  5},  // '!'
+	{    5,  8,  6,  2, 10},  // '"'
+	{   11, 10, 16,  0, 12},  // '#'
+	{   31,  8, 16,  0, 10},  // '$'
+	{   47,  9, 13,  1, 11},  // '%'
+	{   62,  9, 11,  3, 11},  // '&'
+	{   75,  3,  6,  2,  5},  // '\''
+	{   78,  4, 16,  1,  6},  // '('
+	{   86,  4, 16,  1,  6},  // ')'
+	{   94,  8,  9,  1, 10},  // '*'
+	{  103, 10, 10,  3, 12},  // '+'
+	{  116,  4,  6, 11,  6},  // ','
+	{  119,  9,  2,  7, 11},  // '-'
+	{  122,  3,  3, 11,  5},  // '.'
+	{  124,  8, 16,  0, 10},  // '/'
+	{  140,  9, 13,  1, 11},  // '0'
+	{  155,  8, 13,  1, 10},  // '1'
+	{  168,  9, 13,  1, 11},  // '2'
+	{  183, 10, 13,  1, 12},  // '3'
+	{  200,  9, 13,  1, 11},  // '4'
+	{  215,  9, 13,  1, 11},  // '5'
+	{  230,  9, 13,  1, 11},  // '6'
+	{  245,  9, 13,  1, 11},  // '7'
+	{  260,  9, 13,  1, 11},  // '8'
+	{  275,  9, 13,  1, 11},  // '9'
+	{  290,  3,  9,  5,  5},  // ':'
+	{  294,  5, 11,  5,  7},  // ';'
+	{  301, 11, 11,  3, 13},  // '<'
+	{  317, 11,  6,  5, 13},  // '='
+	{  326, 11, 11,  3, 13},  // '>'
+	{  342,  8, 12,  2, 10},  // '?'
+	{  354,  7, 14,  1,  9},  // '@'
+	{  367, 12, 12,  2, 14},  // 'A'
+	{  385, 10, 12,  2, 12},  // 'B'
+	{  400, 10, 12,  2, 12},  // 'C'
+	{  415, 11, 12,  2, 13},  // 'D'
+	{  432, 10, 12,  2, 12},  // 'E'
+	{  447, 10, 12,  2, 12},  // 'F'
+	{  462, 11, 12,  2, 13},  // 'G'
+	{  479, 10, 12,  2, 12},  // 'H'
+	{  494,  8, 12,  2, 10},  // 'I'
+	{  506, 11, 12,  2, 13},  // 'J'
+	{  523, 11, 12,  2, 13},  // 'K'
+	{  540, 10, 12,  2, 12},  // 'L'
+	{  555, 12, 12,  2, 14},  // 'M'
+	{  573, 10, 12,  2, 12},  // 'N'
+	{  588, 10, 12,  2, 12},  // 'O'
+	{  603, 10, 12,  2, 12},  // 'P'
+	{  618, 10, 15,  2, 12},  // 'Q'
+	{  637, 11, 12,  2, 13},  // 'R'
+	{  654, 10, 12,  2, 12},  // 'S'
+	{  669, 10, 12,  2, 12},  // 'T'
+	{  684, 10, 12,  2, 12},  // 'U'
+	{  699, 11, 12,  2, 13},  // 'V'
+	{  716, 13, 12,  2, 15},  // 'W'
+	{  736, 11, 12,  2, 13},  // 'X'
+	{  753, 10, 12,  2, 12},  // 'Y'
+	{  768,  8, 12,  2, 10},  // 'Z'
+	{  780,  4, 16,  1,  6},  // '['
+	{  788,  8, 16,  0, 10},  // '\\'
+	{  804,  4, 16,  1,  6},  // ']'
+	{  812,  9,  6,  1, 11},  // '^'
+	{  819, 14,  2, 18, 16},  // '_'
+	{  823,  4,  3,  1,  6},  // '`'
+	{  825, 10,  9,  5, 12},  // 'a'
+	{  837, 11, 13,  1, 13},  // 'b'
+	{  855, 10,  9,  5, 12},  // 'c'
+	{  867, 11, 13,  1, 13},  // 'd'
+	{  885, 10,  9,  5, 12},  // 'e'
+	{  897,  9, 13,  1, 11},  // 'f'
+	{  912, 11, 13,  5, 13},  // 'g'
+	{  930, 10, 13,  1, 12},  // 'h'
+	{  947,  8, 13,  1, 10},  // 'i'
+	{  960,  8, 17,  1, 10},  // 'j'
+	{  977, 10, 13,  1, 12},  // 'k'
+	{  994,  8, 13,  1, 10},  // 'l'
+	{ 1007, 12,  9,  5, 14},  // 'm'
+	{ 1021, 10,  9,  5, 12},  // 'n'
+	{ 1033, 10,  9,  5, 12},  // 'o'
+	{ 1045, 11, 13,  5, 13},  // 'p'
+	{ 1063, 11, 13,  5, 13},  // 'q'
+	{ 1081, 10,  9,  5, 12},  // 'r'
+	{ 1093,  8,  9,  5, 10},  // 's'
+	{ 1102, 10, 12,  2, 12},  // 't'
+	{ 1117, 10,  9,  5, 12},  // 'u'
+	{ 1129, 11,  9,  5, 13},  // 'v'
+	{ 1142, 11,  9,  5, 13},  // 'w'
+	{ 1155, 10,  9,  5, 12},  // 'x'
+	{ 1167, 11, 13,  5, 13},  // 'y'
+	{ 1185,  8,  9,  5, 10},  // 'z'
+	{ 1194,  6, 16,  1,  8},  // '{'
+	{ 1206,  2, 16,  1,  4},  // '|'
+	{ 1210,  6, 16,  1,  8},  // '}'
+	{ 1222, 10,  4,  6, 12},  // '~'
+};
+
+pFONT Font20P = {
+  Font20P_Bitmap,
+  Font20P_Glyphs,
+  ' ', /* First */
+  '~', /* Last */
+  20, /* Height */
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -454,12 +454,78 @@ const CH_CN Font24CN_Table[] =
 
 };
 
+// GB2312 codes of the table, sorted by code, see Paint_DrawString_CN
+const CH_CN_CODE Font24CN_GB2312[] = 
+{
+  {0x0041, 19},  /* A */
+  {0x0061, 20},  /* a */
+  {0x0062, 21},  /* b */
+  {0x0063, 22},  /* c */
+  {0xB4CB,  6},  /*  */
+  {0xB5C4, 12},  /*  */
+  {0xB5E3, 13},  /*  */
+  {0xB5E7, 25},  /*  */
+  {0xB6D4, 10},  /*  */
+  {0xBAC3,  1},  /*  */
+  {0xBADA,  5},  /*  */
+  {0xC4E3,  0},  /*  */
+  {0xC5C9, 18},  /*  */
+  {0xC8ED,  3},  /*  */
+  {0xCAF7, 16},  /*  */
+  {0xCCE5,  8},  /*  */
+  {0xCEA2,  2},  /* ΢ */
+  {0xCEA2, 23},  /* ΢ */
+  {0xCEAA, 15},  /* Ϊ */
+  {0xCFC2,  9},  /*  */
+  {0xD1A9, 24},  /* ѩ */
+  {0xD1C5,  4},  /*  */
+  {0xD3A6, 11},  /* Ӧ */
+  {0xD5F3, 14},  /*  */
+  {0xD7D3, 26},  /*  */
+  {0xD7D6,  7},  /*  */
+  {0xDDAE, 17},  /* ݮ */
+};
+
+// Unicode code points of the table, sorted by code, see Paint_DrawString_CN
+const CH_CN_CODE Font24CN_Unicode[] = 
+{
+  {0x0041, 19},  /* A */
+  {0x0061, 20},  /* a */
+  {0x0062, 21},  /* b */
+  {0x0063, 22},  /* c */
+  {0x4E0B,  9},  /*  */
+  {0x4E3A, 15},  /* Ϊ */
+  {0x4F53,  8},  /*  */
+  {0x4F60,  0},  /*  */
+  {0x597D,  1},  /*  */
+  {0x5B50, 26},  /*  */
+  {0x5B57,  7},  /*  */
+  {0x5BF9, 10},  /*  */
+  {0x5E94, 11},  /* Ӧ */
+  {0x5FAE,  2},  /* ΢ */
+  {0x5FAE, 23},  /* ΢ */
+  {0x6811, 16},  /*  */
+  {0x6B64,  6},  /*  */
+  {0x6D3E, 18},  /*  */
+  {0x70B9, 13},  /*  */
+  {0x7535, 25},  /*  */
+  {0x7684, 12},  /*  */
+  {0x8393, 17},  /* ݮ */
+  {0x8F6F,  3},  /*  */
+  {0x9635, 14},  /*  */
+  {0x96C5,  4},  /*  */
+  {0x96EA, 24},  /* ѩ */
+  {0x9ED1,  5},  /*  */
+};
+
 cFONT Font24CN = {
   Font24CN_Table,
   sizeof(Font24CN_Table)/sizeof(CH_CN),  /*size of table*/
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  Font24CN_GB2312, /* GB2312 index */
+  Font24CN_Unicode, /* Unicode index */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
\ No newline at end of file
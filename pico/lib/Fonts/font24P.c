@@ -0,0 +1,539 @@
+/**
+  ******************************************************************************
+  * @file    Font24P.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   Proportional Font24, the glyphs of font24.c cut to their ink
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for Courier New 12pt, proportional, rows of the glyph box bit packed
+// 
+
+const uint8_t Font24P_Bitmap[] = 
+{
+	// @0 ' ' (0x0)
+
+	// @0 '!' (3x15)
+	0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xF8,
+
+	// @6 '"' (8x7)
+	0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42,
+
+	// @13 '#' (11x16)
+	0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99, 0xFF, 0xFF, 0xF8, 0xCC, 0x33,
+	0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98,
+
+	// @35 '$' (9x19)
+	0x0C, 0x06, 0x0F, 0x6F, 0xFC, 0x3E, 0x1F, 0x80, 0xF8, 0x3F, 0x03, 0xF0,
+	0x7C, 0x3E, 0x3F, 0xFB, 0x78, 0x18, 0x0C, 0x06, 0x03, 0x00,
+
+	// @57 '%' (10x15)
+	0x3C, 0x1F, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E,
+	0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0,
+
+	// @76 '&' (11x13)
+	0x1F, 0x87, 0xF1, 0x8C, 0x30, 0x06, 0x00, 0x60, 0x0E, 0x03, 0xE7, 0xEF,
+	0xF8, 0xF3, 0x0E, 0x3F, 0xF3, 0xEE,
+
+	// @94 '\'' (3x7)
+	0xFF, 0xA4, 0x90,
+
+	// @97 '(' (6x18)
+	0x0C, 0x73, 0x9E, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E,
+	0x1C, 0x30,
+
+	// @111 ')' (6x18)
+	0xC3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C,
+	0xE3, 0x00,
+
+	// @125 '*' (10x10)
+	0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C,
+	0xC0,
+
+	// @138 '+' (12x12)
+	0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60,
+	0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+
+	// @156 ',' (5x7)
+	0x39, 0x9C, 0xC6, 0x63, 0x00,
+
+	// @161 '-' (10x2)
+	0xFF, 0xFF, 0xF0,
+
+	// @164 '.' (4x3)
+	0xFF, 0xF0,
+
+	// @166 '/' (10x20)
+	0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03,
+	0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03,
+	0x00,
+
+	// @191 '0' (10x15)
+	0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+	0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0,
+
+	// @210 '1' (10x15)
+	0x04, 0x0F, 0x0F, 0xC3, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC,
+
+	// @229 '2' (11x15)
+	0x1F, 0x0F, 0xFB, 0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x07,
+	0x01, 0xC0, 0x60, 0x18, 0x06, 0x01, 0xFF, 0xFF, 0xF8,
+
+	// @250 '3' (10x15)
+	0x1E, 0x1F, 0xC6, 0x38, 0x06, 0x01, 0x80, 0xC1, 0xE0, 0x7C, 0x03, 0x80,
+	0x30, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xE0,
+
+	// @269 '4' (11x15)
+	0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61,
+	0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xF8,
+
+	// @290 '5' (11x15)
+	0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x00,
+	0x60, 0x0C, 0x01, 0x80, 0x3C, 0x0D, 0xFF, 0x8F, 0xC0,
+
+	// @311 '6' (10x15)
+	0x07, 0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0,
+	0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0,
+
+	// @330 '7' (10x15)
+	0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01,
+	0xC0, 0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0,
+
+	// @349 '8' (10x15)
+	0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0,
+	0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0,
+
+	// @368 '9' (10x15)
+	0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0,
+	0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80,
+
+	// @387 ':' (4x11)
+	0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
+
+	// @393 ';' (6x13)
+	0x3C, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80,
+
+	// @403 '<' (14x13)
+	0x00, 0x1C, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+	0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1C,
+
+	// @426 '=' (13x6)
+	0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+
+	// @436 '>' (14x13)
+	0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+	0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0xE0, 0x00,
+
+	// @459 '?' (9x14)
+	0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x1C, 0x1C, 0x3C, 0x1C, 0x0C, 0x00,
+	0x00, 0x03, 0x81, 0xC0,
+
+	// @475 '@' (10x17)
+	0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3,
+	0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07, 0x0C, 0xFF, 0x1F, 0x00,
+
+	// @497 'A' (16x14)
+	0x1F, 0x80, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0x60, 0x03, 0x60, 0x06, 0x30,
+	0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0x18, 0x0C, 0x30, 0x0C,
+	0xFC, 0x7F, 0xFC, 0x7F,
+
+	// @525 'B' (13x14)
+	0xFF, 0xC7, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x03, 0x18, 0x38, 0xFF, 0x87,
+	0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x3F, 0xFF, 0x7F, 0xF0,
+
+	// @548 'C' (12x14)
+	0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00,
+	0xC0, 0x0C, 0x00, 0x60, 0x37, 0x07, 0x3F, 0xE0, 0xFC,
+
+	// @569 'D' (13x14)
+	0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+	0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0,
+
+	// @592 'E' (12x14)
+	0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+	0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF,
+
+	// @613 'F' (12x14)
+	0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+	0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,
+
+	// @634 'G' (13x14)
+	0x0F, 0xB1, 0xFF, 0x9C, 0x1C, 0xC0, 0x6C, 0x03, 0x60, 0x03, 0x00, 0x18,
+	0x7F, 0xC3, 0xFE, 0x01, 0xB8, 0x0C, 0xE0, 0xE3, 0xFF, 0x07, 0xE0,
+
+	// @657 'H' (14x14)
+	0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0xFF,
+	0x0F, 0xFC, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3,
+	0xF0,
+
+	// @682 'I' (10x14)
+	0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,
+
+	// @700 'J' (13x14)
+	0x1F, 0xF8, 0xFF, 0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18,
+	0x18, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x0F, 0xF8, 0x1F, 0x00,
+
+	// @723 'K' (15x14)
+	0xFE, 0x7D, 0xFC, 0xF8, 0xC1, 0x81, 0x86, 0x03, 0x18, 0x06, 0x60, 0x0D,
+	0xC0, 0x1F, 0xC0, 0x39, 0xC0, 0x61, 0xC0, 0xC1, 0x81, 0x83, 0x8F, 0xE3,
+	0xFF, 0xC7, 0xC0,
+
+	// @750 'L' (13x14)
+	0xFF, 0x07, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03,
+	0x00, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x3F, 0xFF, 0xFF, 0xFC,
+
+	// @773 'M' (16x14)
+	0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C,
+	0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C,
+	0xFE, 0x7F, 0xFE, 0x7F,
+
+	// @801 'N' (14x14)
+	0xF1, 0xFF, 0xC7, 0xF3, 0x83, 0x0F, 0x0C, 0x3E, 0x30, 0xD8, 0xC3, 0x73,
+	0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3, 0x0F, 0x0C, 0x1C, 0xFE, 0x33, 0xF8,
+	0xC0,
+
+	// @826 'O' (12x14)
+	0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03,
+	0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF0,
+
+	// @847 'P' (12x14)
+	0xFF, 0xCF, 0xFE, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30, 0x63, 0xFE,
+	0x3F, 0x83, 0x00, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,
+
+	// @868 'Q' (12x17)
+	0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03,
+	0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC1, 0xF0, 0x1F, 0x33, 0xFF,
+	0x30, 0xE0,
+
+	// @894 'R' (14x14)
+	0xFF, 0xC3, 0xFF, 0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0xC3, 0xFE,
+	0x0F, 0xE0, 0x31, 0xC0, 0xC3, 0x83, 0x06, 0x0C, 0x1C, 0xFE, 0x3F, 0xF8,
+	0x70,
+
+	// @919 'S' (10x14)
+	0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0,
+	0x3C, 0x0F, 0x87, 0xFF, 0xB7, 0xC0,
+
+	// @937 'T' (12x14)
+	0xFF, 0xFF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0x06, 0x00, 0x60,
+	0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xC3, 0xFC,
+
+	// @958 'U' (14x14)
+	0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E,
+	0x00,
+
+	// @983 'V' (15x14)
+	0xFE, 0xFF, 0xFD, 0xFC, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x03,
+	0x18, 0x06, 0x30, 0x06, 0xC0, 0x0D, 0x80, 0x1B, 0x00, 0x1C, 0x00, 0x38,
+	0x00, 0x20, 0x00,
+
+	// @1010 'W' (17x14)
+	0xFE, 0x3F, 0xFF, 0x1F, 0xCC, 0x01, 0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE,
+	0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B, 0x6C, 0x0F, 0x3E, 0x03, 0x8E, 0x01,
+	0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0,
+
+	// @1040 'X' (14x14)
+	0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x1E, 0x00, 0x30,
+	0x00, 0xC0, 0x07, 0x80, 0x33, 0x01, 0x86, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3,
+	0xF0,
+
+	// @1065 'Y' (14x14)
+	0xF8, 0xFF, 0xE3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x33, 0x00, 0x78,
+	0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F,
+	0x80,
+
+	// @1090 'Z' (11x14)
+	0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66, 0x18, 0xC6, 0x01, 0x80, 0x60, 0x18,
+	0x66, 0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
+
+	// @1110 '[' (5x18)
+	0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0,
+
+	// @1122 '\\' (10x20)
+	0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03,
+	0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C,
+	0x03,
+
+	// @1147 ']' (5x18)
+	0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xC0,
+
+	// @1159 '^' (11x8)
+	0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01,
+
+	// @1170 '_' (16x2)
+	0xFF, 0xFF, 0xFF, 0xFF,
+
+	// @1174 '`' (5x4)
+	0xC7, 0x0E, 0x30,
+
+	// @1177 'a' (12x11)
+	0x3F, 0x07, 0xF8, 0x00, 0xC0, 0x0C, 0x1F, 0xC7, 0xFC, 0xE0, 0xCC, 0x0C,
+	0xC1, 0xC7, 0xFF, 0x3E, 0xF0,
+
+	// @1194 'b' (13x15)
+	0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6,
+	0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF,
+	0x00,
+
+	// @1219 'c' (12x11)
+	0x0F, 0xB3, 0xFF, 0x70, 0x7E, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0E, 0x03,
+	0x70, 0x73, 0xFE, 0x0F, 0xC0,
+
+	// @1236 'd' (13x15)
+	0x01, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0xC1, 0xF6, 0x3F, 0xF1, 0x83, 0x98,
+	0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xFC, 0x7D,
+	0xE0,
+
+	// @1261 'e' (12x11)
+	0x1F, 0x87, 0xFE, 0x60, 0x6C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00,
+	0x60, 0x37, 0xFF, 0x1F, 0xC0,
+
+	// @1278 'f' (12x15)
+	0x07, 0xF0, 0xFF, 0x18, 0x01, 0x80, 0xFF, 0xEF, 0xFE, 0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0,
+
+	// @1301 'g' (13x16)
+	0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98,
+	0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x70, 0xFF,
+	0x07, 0xE0,
+
+	// @1327 'h' (14x15)
+	0xF0, 0x03, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x37, 0xC0, 0xFF, 0x83, 0x87,
+	0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3,
+	0xFF, 0xCF, 0xC0,
+
+	// @1354 'i' (12x15)
+	0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60,
+	0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0,
+
+	// @1377 'j' (9x20)
+	0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0,
+	0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x80,
+
+	// @1400 'k' (12x15)
+	0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60,
+	0x3E, 0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F, 0x1F, 0xF1, 0xF0,
+
+	// @1423 'l' (12x15)
+	0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+	0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0,
+
+	// @1446 'm' (16x11)
+	0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C,
+	0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF,
+
+	// @1468 'n' (14x11)
+	0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0,
+
+	// @1488 'o' (12x11)
+	0x0F, 0x03, 0xFC, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07,
+	0x70, 0xE3, 0xFC, 0x0F, 0x00,
+
+	// @1505 'p' (13x16)
+	0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+	0x03, 0x38, 0x31, 0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8,
+	0x1F, 0xC0,
+
+	// @1531 'q' (13x16)
+	0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98,
+	0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x0F,
+	0xE0, 0x7F,
+
+	// @1557 'r' (12x11)
+	0xF9, 0xEF, 0xBF, 0x1F, 0x31, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+	0x18, 0x0F, 0xFC, 0xFF, 0xC0,
+
+	// @1574 's' (10x11)
+	0x3F, 0xDF, 0xFC, 0x0F, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xC1, 0xFF,
+	0xEF, 0xF0,
+
+	// @1588 't' (12x15)
+	0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xFF, 0xCF, 0xFC, 0x30, 0x03, 0x00,
+	0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x71, 0xFF, 0x0F, 0xC0,
+
+	// @1611 'u' (14x11)
+	0xF0, 0xF3, 0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0, 0xFB, 0xC0,
+
+	// @1631 'v' (14x11)
+	0xF8, 0x7F, 0xE1, 0xF3, 0x03, 0x0C, 0x0C, 0x18, 0x60, 0x61, 0x80, 0xCC,
+	0x03, 0x30, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00,
+
+	// @1651 'w' (13x11)
+	0xF0, 0x7F, 0x83, 0xD8, 0x8C, 0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87,
+	0xBC, 0x38, 0xC0, 0xC6, 0x06, 0x30,
+
+	// @1669 'x' (12x11)
+	0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x98,
+	0x30, 0xCF, 0x9F, 0xF9, 0xF0,
+
+	// @1686 'y' (15x16)
+	0xFC, 0x3F, 0xF8, 0x7C, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x01, 0x8C, 0x03,
+	0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30,
+	0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0,
+
+	// @1716 'z' (10x11)
+	0xFF, 0xFF, 0xFC, 0x1B, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC3, 0x60, 0xFF,
+	0xFF, 0xFC,
+
+	// @1730 '{' (6x18)
+	0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0C,
+	0x3C, 0x70,
+
+	// @1744 '|' (2x18)
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+
+	// @1749 '}' (6x18)
+	0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x0C,
+	0xF3, 0x80,
+
+	// @1763 '~' (11x5)
+	0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38,
+};
+
+// offset, width, height, top, advance
+const pGLYPH Font24P_Glyphs[] = 
+{
+	{    0,  0,  0,  0,  9},  // ' '
+	{    0,  3, 15,  2,  5},  // '!'
+	{    6,  8,  7,  3, 10},  // '"'
+	{   13, 11, 16,  2, 13},  // '#'
+	{   35,  9, 19,  1, 11},  // '$'
+	{   57, 10, 15,  2, 12},  // '%'
+	{   76, 11, 13,  4, 13},  // '&'
+	{   94,  3,  7,  3,  5},  // '\''
+	{   97,  6, 18,  2,  8},  // '('
+	{  111,  6, 18,  2,  8},  // ')'
+	{  125, 10, 10,  2, 12},  // '*'
+	{  138, 12, 12,  4, 14},  // '+'
+	{  156,  5,  7, 14,  7},  // ','
+	{  161, 10,  2,  9, 12},  // '-'
+	{  164,  4,  3, 14,  6},  // '.'
+	{  166, 10, 20,  0, 12},  // '/'
+	{  191, 10, 15,  2, 12},  // '0'
+	{  210, 10, 15,  2, 12},  // '1'
+	{  229, 11, 15,  2, 13},  // '2'
+	{  250, 10, 15,  2, 12},  // '3'
+	{  269, 11, 15,  2, 13},  // '4'
+	{  290, 11, 15,  2, 13},  // '5'
+	{  311, 10, 15,  2, 12},  // '6'
+	{  330, 10, 15,  2, 12},  // '7'
+	{  349, 10, 15,  2, 12},  // '8'
+	{  368, 10, 15,  2, 12},  // '9'
+	{  387,  4, 11,  6,  6},  // ':'
+	{  393,  6, 13,  6,  8},  // ';'
+	{  403, 14, 13,  4, 16},  // '<'
+	{  426, 13,  6,  7, 15},  // '='
+	{  436, 14, 13,  4, 16},  // '>'
+	{  459,  9, 14,  3, 11},  // '?'
+	{  475, 10, 17,  2, 12},  // '@'
+	{  497, 16, 14,  3, 18},  // 'A'
+	{  525, 13, 14,  3, 15},  // 'B'
+	{  548, 12, 14,  3, 14},  // 'C'
+	{  569, 13, 14,  3, 15},  // 'D'
+	{  592, 12, 14,  3, 14},  // 'E'
+	{  613, 12, 14,  3, 14},  // 'F'
+	{  634, 13, 14,  3, 15},  // 'G'
+	{  657, 14, 14,  3, 16},  // 'H'
+	{  682, 10, 14,  3, 12},  // 'I'
+	{  700, 13, 14,  3, 15},  // 'J'
+	{  723, 15, 14,  3, 17},  // 'K'
+	{  750, 13, 14,  3, 15},  // 'L'
+	{  773, 16, 14,  3, 18},  // 'M'
+	{  801, 14, 14,  3, 16},  // 'N'
+	{  826, 12, 14,  3, 14},  // 'O'
+	{  847, 12, 14,  3, 14},  // 'P'
+	{  868, 12, 17,  3, 14},  // 'Q'
+	{  894, 14, 14,  3, 16},  // 'R'
+	{  919, 10, 14,  3, 12},  // 'S'
+	{  937, 12, 14,  3, 14},  // 'T'
+	{  958, 14, 14,  3, 16},  // 'U'
+	{  983, 15, 14,  3, 17},  // 'V'
+	{ 1010, 17, 14,  3, 19},  // 'W'
+	{ 1040, 14, 14,  3, 16},  // 'X'
+	{ 1065, 14, 14,  3, 16},  // 'Y'
+	{ 1090, 11, 14,  3, 13},  // 'Z'
+	{ 1110,  5, 18,  2,  7},  // '['
+	{ 1122, 10, 20,  0, 12},  // '\\'
+	{ 1147,  5, 18,  2,  7},  // ']'
+	{ 1159, 11,  8,  1, 13},  // '^'
+	{ 1170, 16,  2, 22, 18},  // '_'
+	{ 1174,  5,  4,  1,  7},  // '`'
+	{ 1177, 12, 11,  6, 14},  // 'a'
+	{ 1194, 13, 15,  2, 15},  // 'b'
+	{ 1219, 12, 11,  6, 14},  // 'c'
+	{ 1236, 13, 15,  2, 15},  // 'd'
+	{ 1261, 12, 11,  6, 14},  // 'e'
+	{ 1278, 12, 15,  2, 14},  // 'f'
+	{ 1301, 13, 16,  6, 15},  // 'g'
+	{ 1327, 14, 15,  2, 16},  // 'h'
+	{ 1354, 12, 15,  2, 14},  // 'i'
+	{ 1377,  9, 20,  2, 11},  // 'j'
+	{ 1400, 12, 15,  2, 14},  // 'k'
+	{ 1423, 12, 15,  2, 14},  // 'l'
+	{ 1446, 16, 11,  6, 18},  // 'm'
+	{ 1468, 14, 11,  6, 16},  // 'n'
+	{ 1488, 12, 11,  6, 14},  // 'o'
+	{ 1505, 13, 16,  6, 15},  // 'p'
+	{ 1531, 13, 16,  6, 15},  // 'q'
+	{ 1557, 12, 11,  6, 14},  // 'r'
+	{ 1574, 10, 11,  6, 12},  // 's'
+	{ 1588, 12, 15,  2, 14},  // 't'
+	{ 1611, 14, 11,  6, 16},  // 'u'
+	{ 1631, 14, 11,  6, 16},  // 'v'
+	{ 1651, 13, 11,  6, 15},  // 'w'
+	{ 1669, 12, 11,  6, 14},  // 'x'
+	{ 1686, 15, 16,  6, 17},  // 'y'
+	{ 1716, 10, 11,  6, 12},  // 'z'
+	{ 1730,  6, 18,  2,  8},  // '{'
+	{ 1744,  2, 18,  2,  4},  // '|'
+	{ 1749,  6, 18,  2,  8},  // '}'
+	{ 1763, 11,  5,  8, 13},  // '~'
+};
+
+pFONT Font24P = {
+  Font24P_Bitmap,
+  Font24P_Glyphs,
+  ' ', /* First */
+  '~', /* Last */
+  24, /* Height */
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
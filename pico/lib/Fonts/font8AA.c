@@ -0,0 +1,440 @@
+/**
+  ******************************************************************************
+  * @file    Font8AA.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   Anti-aliased Font8AA, the glyphs of font16.c at half size
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for Courier New 12pt, anti-aliased, 2 bits of coverage per pixel
+// 
+
+const uint8_t Font8AA_Bitmap[] = 
+{
+	// @0 ' ' (0x0)
+
+	// @0 '!' (1x6)
+	0xBF, 0xA0,
+
+	// @2 '"' (4x3)
+	0xBB, 0x22, 0x11,
+
+	// @5 '#' (4x6)
+	0x25, 0x3A, 0xBA, 0xAE, 0xAC, 0xAC,
+
+	// @11 '$' (4x7)
+	0x69, 0xCA, 0xA4, 0x2D, 0xCA, 0xA8, 0x10,
+
+	// @18 '%' (4x6)
+	0x50, 0xA0, 0x6A, 0xA9, 0x0A, 0x05,
+
+	// @24 '&' (4x5)
+	0x68, 0xA0, 0x75, 0xDC, 0x65,
+
+	// @29 '\'' (2x3)
+	0xB2, 0x10,
+
+	// @31 '(' (2x7)
+	0x26, 0xDC, 0xD6, 0x20,
+
+	// @35 ')' (3x7)
+	0x51, 0x82, 0x8A, 0x29, 0xC5, 0x00,
+
+	// @41 '*' (4x4)
+	0x14, 0xAA, 0xBE, 0xAA,
+
+	// @45 '+' (4x4)
+	0x10, 0x20, 0xA9, 0x20,
+
+	// @49 ',' (2x3)
+	0x58, 0x80,
+
+	// @51 '-' (4x1)
+	0xA9,
+
+	// @52 '.' (1x2)
+	0xA0,
+
+	// @53 '/' (4x7)
+	0x03, 0x0A, 0x0C, 0x24, 0x60, 0x90, 0x80,
+
+	// @60 '0' (4x6)
+	0x24, 0x99, 0xCA, 0xCA, 0x99, 0x24,
+
+	// @66 '1' (4x6)
+	0x14, 0xA8, 0x28, 0x28, 0x28, 0xAA,
+
+	// @72 '2' (4x6)
+	0x28, 0x9A, 0x89, 0x24, 0x90, 0xA9,
+
+	// @78 '3' (5x6)
+	0x2A, 0x14, 0xA1, 0xB0, 0x0A, 0x52, 0x8A, 0x80,
+
+	// @86 '4' (4x6)
+	0x18, 0x2C, 0x6C, 0x8C, 0xAD, 0x29,
+
+	// @92 '5' (4x6)
+	0x69, 0xA0, 0xA8, 0x4A, 0x4A, 0x68,
+
+	// @98 '6' (4x6)
+	0x19, 0xA0, 0xD8, 0xDA, 0x9A, 0x28,
+
+	// @104 '7' (4x6)
+	0x6A, 0x43, 0x0A, 0x0A, 0x0C, 0x08,
+
+	// @110 '8' (4x6)
+	0x68, 0xCA, 0xA9, 0xCA, 0xCA, 0x68,
+
+	// @116 '9' (4x6)
+	0x64, 0xC9, 0xCA, 0x6A, 0x1C, 0xA0,
+
+	// @122 ':' (1x4)
+	0xCA,
+
+	// @123 ';' (2x5)
+	0x30, 0x58, 0x40,
+
+	// @126 '<' (5x5)
+	0x02, 0x86, 0x06, 0x40, 0x18, 0x00, 0x80,
+
+	// @133 '=' (5x2)
+	0x6A, 0x9A, 0xA0,
+
+	// @136 '>' (5x5)
+	0x64, 0x01, 0x80, 0x28, 0x60, 0x50, 0x00,
+
+	// @143 '?' (4x5)
+	0xA9, 0x8A, 0x28, 0x20, 0x20,
+
+	// @148 '@' (3x6)
+	0x26, 0x29, 0xAA, 0x99, 0xA0,
+
+	// @153 'A' (6x5)
+	0x2F, 0x01, 0xA4, 0x2A, 0x83, 0x0C, 0x65, 0x90,
+
+	// @161 'B' (5x5)
+	0x7A, 0x4C, 0xA3, 0xA4, 0xCA, 0x6A, 0x00,
+
+	// @168 'C' (5x5)
+	0x2A, 0xA8, 0x1A, 0x01, 0x82, 0x1A, 0x00,
+
+	// @175 'D' (5x5)
+	0x7A, 0x4C, 0x33, 0x0C, 0xC6, 0x6A, 0x00,
+
+	// @182 'E' (5x5)
+	0x7A, 0x8C, 0x53, 0xA0, 0xC2, 0x6A, 0x40,
+
+	// @189 'F' (5x5)
+	0x7A, 0x8C, 0x53, 0xA0, 0xC0, 0x68, 0x00,
+
+	// @196 'G' (5x5)
+	0x2A, 0xA8, 0x1A, 0x69, 0x8A, 0x1A, 0x00,
+
+	// @203 'H' (5x5)
+	0x76, 0x8C, 0xA3, 0xA8, 0xCA, 0x66, 0x80,
+
+	// @210 'I' (4x5)
+	0xAA, 0x28, 0x28, 0x28, 0xAA,
+
+	// @215 'J' (5x5)
+	0x1B, 0x80, 0xC5, 0x32, 0x8C, 0x29, 0x00,
+
+	// @222 'K' (5x5)
+	0x76, 0x8D, 0x83, 0xD0, 0xC9, 0x65, 0x80,
+
+	// @229 'L' (5x5)
+	0x69, 0x0A, 0x02, 0x84, 0xA2, 0x6A, 0x80,
+
+	// @236 'M' (6x5)
+	0xA0, 0xDB, 0x6C, 0xAA, 0xCA, 0x4C, 0xA6, 0x90,
+
+	// @244 'N' (5x5)
+	0x72, 0x8E, 0xA3, 0xA8, 0xCA, 0x65, 0x40,
+
+	// @251 'O' (5x5)
+	0x2A, 0x68, 0x3A, 0x0D, 0x86, 0x1A, 0x00,
+
+	// @258 'P' (5x5)
+	0x7A, 0x4C, 0xA3, 0xA4, 0xC0, 0x69, 0x00,
+
+	// @265 'Q' (5x6)
+	0x2A, 0x68, 0x3A, 0x0D, 0x86, 0x1E, 0x86, 0x90,
+
+	// @273 'R' (6x5)
+	0x7A, 0x43, 0x28, 0x3A, 0x03, 0x28, 0x68, 0x90,
+
+	// @281 'S' (4x5)
+	0xAA, 0xD5, 0x6D, 0xCA, 0xA8,
+
+	// @286 'T' (5x5)
+	0xAE, 0xA3, 0x20, 0xC0, 0x30, 0x2A, 0x00,
+
+	// @293 'U' (5x5)
+	0x76, 0x8C, 0xA3, 0x28, 0xCA, 0x1A, 0x00,
+
+	// @300 'V' (5x5)
+	0x76, 0x89, 0x92, 0xB0, 0x28, 0x09, 0x00,
+
+	// @307 'W' (6x5)
+	0xA6, 0xDA, 0x9C, 0x6A, 0x83, 0xB8, 0x21, 0x40,
+
+	// @315 'X' (5x5)
+	0x76, 0x86, 0x80, 0xE0, 0x99, 0x66, 0x80,
+
+	// @322 'Y' (6x5)
+	0x75, 0xD1, 0xA4, 0x0A, 0x00, 0xA0, 0x1A, 0x40,
+
+	// @330 'Z' (4x5)
+	0xAA, 0x58, 0x20, 0x92, 0xA9,
+
+	// @335 '[' (3x7)
+	0x66, 0x8A, 0x28, 0xA2, 0x86, 0x40,
+
+	// @341 '\\' (4x7)
+	0xC0, 0xA0, 0x30, 0x18, 0x09, 0x06, 0x02,
+
+	// @348 ']' (3x7)
+	0x64, 0xA2, 0x8A, 0x28, 0xA6, 0x40,
+
+	// @354 '^' (4x3)
+	0x24, 0x58, 0x82,
+
+	// @357 '_' (6x1)
+	0xAA, 0x90,
+
+	// @359 '`' (2x2)
+	0x81,
+
+	// @360 'a' (4x4)
+	0x69, 0x6A, 0xCA, 0x66,
+
+	// @364 'b' (5x6)
+	0x60, 0x0C, 0x03, 0xA4, 0xC3, 0x35, 0x99, 0x80,
+
+	// @372 'c' (5x4)
+	0x2A, 0xA8, 0x16, 0x18, 0x68,
+
+	// @377 'd' (5x6)
+	0x02, 0x40, 0xA2, 0xAA, 0x8A, 0x62, 0x86, 0x60,
+
+	// @385 'e' (5x4)
+	0x2A, 0x6A, 0xB6, 0x08, 0x69,
+
+	// @390 'f' (5x6)
+	0x1A, 0x4C, 0x0B, 0x90, 0xC0, 0x30, 0x2A, 0x40,
+
+	// @398 'g' (5x5)
+	0x2A, 0xA8, 0xA6, 0x28, 0x6A, 0x1A, 0x40,
+
+	// @405 'h' (5x6)
+	0x60, 0x0C, 0x03, 0xA4, 0xCA, 0x32, 0x99, 0xA0,
+
+	// @413 'i' (4x6)
+	0x14, 0x14, 0x68, 0x28, 0x28, 0xAA,
+
+	// @419 'j' (3x7)
+	0x14, 0x5A, 0xC3, 0x0C, 0x3A, 0x80,
+
+	// @425 'k' (5x6)
+	0x60, 0x0C, 0x03, 0xA4, 0xF0, 0x36, 0x19, 0xA0,
+
+	// @433 'l' (4x6)
+	0x64, 0x28, 0x28, 0x28, 0x28, 0xAA,
+
+	// @439 'm' (6x4)
+	0x7A, 0x83, 0xAC, 0x3A, 0xC6, 0x59,
+
+	// @445 'n' (5x4)
+	0x7A, 0x4C, 0xA3, 0x29, 0x9A,
+
+	// @450 'o' (5x4)
+	0x2A, 0x68, 0x36, 0x18, 0x68,
+
+	// @455 'p' (5x5)
+	0x7A, 0x4C, 0x33, 0x58, 0xD8, 0x78, 0x00,
+
+	// @462 'q' (5x5)
+	0x2A, 0xA8, 0xA6, 0x28, 0x6A, 0x06, 0x80,
+
+	// @469 'r' (5x4)
+	0x6A, 0x8A, 0x02, 0x81, 0xA8,
+
+	// @474 's' (4x4)
+	0xAA, 0xB8, 0x8A, 0xA8,
+
+	// @478 't' (5x6)
+	0x14, 0x0A, 0x06, 0xA0, 0xA0, 0x28, 0x42, 0x80,
+
+	// @486 'u' (5x4)
+	0x72, 0x8C, 0xA3, 0x28, 0x66,
+
+	// @491 'v' (5x4)
+	0x76, 0x89, 0x91, 0xA0, 0x24,
+
+	// @496 'w' (6x4)
+	0xA1, 0xDA, 0x9C, 0x3B, 0x82, 0x14,
+
+	// @502 'x' (5x4)
+	0x6B, 0x83, 0x81, 0xA1, 0x9A,
+
+	// @507 'y' (6x5)
+	0x75, 0xD2, 0xA8, 0x0B, 0x00, 0xA0, 0x2D, 0x00,
+
+	// @515 'z' (4x4)
+	0xAA, 0x28, 0x91, 0xA9,
+
+	// @519 '{' (3x7)
+	0x14, 0xC3, 0x18, 0x30, 0xC1, 0x40,
+
+	// @525 '|' (2x7)
+	0x5A, 0xAA, 0xAA, 0x50,
+
+	// @529 '}' (2x7)
+	0x8A, 0xA6, 0xAA, 0x80,
+
+	// @533 '~' (4x2)
+	0x50, 0x59,
+};
+
+// offset, width, height, top, advance
+const pGLYPH Font8AA_Glyphs[] = 
+{
+	{    0,  0,  0,  0,  3},  // ' '
+	{    0,  1,  6,  0,  2},  // '!'
+	{    2,  4,  3,  1,  5},  // '"'
+	{    5,  4,  6,  0,  5},  // '#'
+	{   11,  4,  7,  0,  5},  // '$'
+	{   18,  4,  6,  0,  5},  // '%'
+	{   24,  4,  5,  1,  5},  // '&'
+	{   29,  2,  3,  1,  3},  // '\''
+	{   31,  2,  7,  0,  3},  // '('
+	{   35,  3,  7,  0,  4},  // ')'
+	{   41,  4,  4,  0,  5},  // '*'
+	{   45,  4,  4,  1,  5},  // '+'
+	{   49,  2,  3,  4,  3},  // ','
+	{   51,  4,  1,  3,  5},  // '-'
+	{   52,  1,  2,  4,  2},  // '.'
+	{   53,  4,  7,  0,  5},  // '/'
+	{   60,  4,  6,  0,  5},  // '0'
+	{   66,  4,  6,  0,  5},  // '1'
+	{   72,  4,  6,  0,  5},  // '2'
+	{   78,  5,  6,  0,  6},  // '3'
+	{   86,  4,  6,  0,  5},  // '4'
+	{   92,  4,  6,  0,  5},  // '5'
+	{   98,  4,  6,  0,  5},  // '6'
+	{  104,  4,  6,  0,  5},  // '7'
+	{  110,  4,  6,  0,  5},  // '8'
+	{  116,  4,  6,  0,  5},  // '9'
+	{  122,  1,  4,  2,  2},  // ':'
+	{  123,  2,  5,  2,  3},  // ';'
+	{  126,  5,  5,  1,  6},  // '<'
+	{  133,  5,  2,  2,  6},  // '='
+	{  136,  5,  5,  1,  6},  // '>'
+	{  143,  4,  5,  1,  5},  // '?'
+	{  148,  3,  6,  0,  4},  // '@'
+	{  153,  6,  5,  1,  7},  // 'A'
+	{  161,  5,  5,  1,  6},  // 'B'
+	{  168,  5,  5,  1,  6},  // 'C'
+	{  175,  5,  5,  1,  6},  // 'D'
+	{  182,  5,  5,  1,  6},  // 'E'
+	{  189,  5,  5,  1,  6},  // 'F'
+	{  196,  5,  5,  1,  6},  // 'G'
+	{  203,  5,  5,  1,  6},  // 'H'
+	{  210,  4,  5,  1,  5},  // 'I'
+	{  215,  5,  5,  1,  6},  // 'J'
+	{  222,  5,  5,  1,  6},  // 'K'
+	{  229,  5,  5,  1,  6},  // 'L'
+	{  236,  6,  5,  1,  7},  // 'M'
+	{  244,  5,  5,  1,  6},  // 'N'
+	{  251,  5,  5,  1,  6},  // 'O'
+	{  258,  5,  5,  1,  6},  // 'P'
+	{  265,  5,  6,  1,  6},  // 'Q'
+	{  273,  6,  5,  1,  7},  // 'R'
+	{  281,  4,  5,  1,  5},  // 'S'
+	{  286,  5,  5,  1,  6},  // 'T'
+	{  293,  5,  5,  1,  6},  // 'U'
+	{  300,  5,  5,  1,  6},  // 'V'
+	{  307,  6,  5,  1,  7},  // 'W'
+	{  315,  5,  5,  1,  6},  // 'X'
+	{  322,  6,  5,  1,  7},  // 'Y'
+	{  330,  4,  5,  1,  5},  // 'Z'
+	{  335,  3,  7,  0,  4},  // '['
+	{  341,  4,  7,  0,  5},  // '\\'
+	{  348,  3,  7,  0,  4},  // ']'
+	{  354,  4,  3,  0,  5},  // '^'
+	{  357,  6,  1,  7,  7},  // '_'
+	{  359,  2,  2,  0,  3},  // '`'
+	{  360,  4,  4,  2,  5},  // 'a'
+	{  364,  5,  6,  0,  6},  // 'b'
+	{  372,  5,  4,  2,  6},  // 'c'
+	{  377,  5,  6,  0,  6},  // 'd'
+	{  385,  5,  4,  2,  6},  // 'e'
+	{  390,  5,  6,  0,  6},  // 'f'
+	{  398,  5,  5,  2,  6},  // 'g'
+	{  405,  5,  6,  0,  6},  // 'h'
+	{  413,  4,  6,  0,  5},  // 'i'
+	{  419,  3,  7,  0,  4},  // 'j'
+	{  425,  5,  6,  0,  6},  // 'k'
+	{  433,  4,  6,  0,  5},  // 'l'
+	{  439,  6,  4,  2,  7},  // 'm'
+	{  445,  5,  4,  2,  6},  // 'n'
+	{  450,  5,  4,  2,  6},  // 'o'
+	{  455,  5,  5,  2,  6},  // 'p'
+	{  462,  5,  5,  2,  6},  // 'q'
+	{  469,  5,  4,  2,  6},  // 'r'
+	{  474,  4,  4,  2,  5},  // 's'
+	{  478,  5,  6,  0,  6},  // 't'
+	{  486,  5,  4,  2,  6},  // 'u'
+	{  491,  5,  4,  2,  6},  // 'v'
+	{  496,  6,  4,  2,  7},  // 'w'
+	{  502,  5,  4,  2,  6},  // 'x'
+	{  507,  6,  5,  2,  7},  // 'y'
+	{  515,  4,  4,  2,  5},  // 'z'
+	{  519,  3,  7,  0,  4},  // '{'
+	{  525,  2,  7,  0,  3},  // '|'
+	{  529,  2,  7,  0,  3},  // '}'
+	{  533,  4,  2,  2,  5},  // '~'
+};
+
+aFONT Font8AA = {
+  Font8AA_Bitmap,
+  Font8AA_Glyphs,
+  ' ', /* First */
+  '~', /* Last */
+  8, /* Height */
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -59,6 +59,38 @@ typedef struct _tFont
   uint16_t Height;
 } sFONT;
 
+// A glyph of a proportional font, its box cut to the ink
+typedef struct
+{
+  uint16_t offset;                                    // First byte of the glyph in bitmap
+  uint8_t width;                                      // Box, 0 x 0 for a glyph without ink
+  uint8_t height;
+  uint8_t top;                                        // Rows from the top of the line to the box
+  uint8_t advance;                                    // Pixels from this glyph to the next
+}pGLYPH;
+
+// Proportional font. A glyph is the rows of its box bit packed, MSB first,
+// each row right after the previous one and the glyph from a whole byte
+typedef struct
+{
+  const uint8_t *bitmap;
+  const pGLYPH *glyphs;                               // Characters first .. last
+  uint8_t first;
+  uint8_t last;
+  uint16_t Height;                                    // Line height
+}pFONT;
+
+// Anti-aliased font, laid out as pFONT with 2 bits per pixel, the coverage
+// of the pixel by ink from 0 to 3
+typedef struct
+{
+  const uint8_t *bitmap;
+  const pGLYPH *glyphs;                               // Characters first .. last
+  uint8_t first;
+  uint8_t last;
+  uint16_t Height;                                    // Line height
+}aFONT;
+
 
 //GB2312
 typedef struct                                          // ģݽṹ
@@ -67,6 +99,13 @@ typedef struct                                          // 
   const  char matrix[MAX_HEIGHT_FONT*MAX_WIDTH_FONT/8+2];  // 
 }CH_CN;
 
+// One entry of a glyph index, the entries of an index are sorted by code
+typedef struct
+{
+  uint16_t code;                                      // GB2312 code or Unicode code point, ASCII is the same in both
+  uint16_t glyph;                                     // Position in the table
+}CH_CN_CODE;
+
 
 typedef struct
 {    
@@ -75,6 +114,8 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const CH_CN_CODE *gb2312;                           // size entries
+  const CH_CN_CODE *unicode;                          // size entries
   
 }cFONT;
 
@@ -84,6 +125,16 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern pFONT Font24P;
+extern pFONT Font20P;
+extern pFONT Font16P;
+extern pFONT Font12P;
+extern pFONT Font8P;
+
+extern aFONT Font12AA;
+extern aFONT Font10AA;
+extern aFONT Font8AA;
+
 extern cFONT Font12CN;
 extern cFONT Font24CN;
 #ifdef __cplusplus
@@ -0,0 +1,690 @@
+/*****************************************************************************
+* | File      	:   GUI_Barcode.c
+* | Function    :   Draw QR codes and Code128 barcodes into a paint image
+* | Info        :
+*   A QR code is built in module bitmaps: the function patterns first,
+*   then the codewords in the zigzag order, the blocks interleaved with
+*   their Reed-Solomon error correction over GF(256). Each of the 8 masks
+*   is tried and the one with the lowest penalty is kept. A Code128
+*   symbol is a row of 11 module patterns, one per symbol value.
+*   Both are drawn as a background rectangle over the symbol and its
+*   quiet zone, then one rectangle per run of dark modules.
+******************************************************************************/
+#include "GUI_Barcode.h"
+#include "Debug.h"
+#include <string.h>
+
+#define QR_ECC_BLOCK_MAX    30      // Error correction codewords of one block
+
+// Error correction codewords per block and number of blocks, by level and version
+static const UBYTE Qr_EccPerBlock[4][QR_VERSION_MAX + 1] = {
+    {0,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18},
+    {0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26},
+    {0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24},
+    {0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28},
+};
+static const UBYTE Qr_Blocks[4][QR_VERSION_MAX + 1] = {
+    {0,  1,  1,  1,  1,  1,  2,  2,  2,  2,  4},
+    {0,  1,  1,  1,  2,  2,  4,  4,  4,  5,  5},
+    {0,  1,  1,  2,  2,  4,  4,  6,  6,  8,  8},
+    {0,  1,  1,  2,  4,  4,  4,  5,  6,  8,  8},
+};
+// The level as it is written in the format bits
+static const UBYTE Qr_EccFormat[4] = {1, 0, 3, 2};
+
+// Workspace of Barcode_DrawQR, which draws in the global Paint
+static QR_WORKSPACE Qr_Work;
+
+// Bar patterns of the symbol values, MSB first, set is a bar. The stop pattern is 13 modules
+static const UWORD Code128_Patterns[107] = {
+    0x6CC, 0x66C, 0x666, 0x498, 0x48C, 0x44C, 0x4C8, 0x4C4,
+    0x464, 0x648, 0x644, 0x624, 0x59C, 0x4DC, 0x4CE, 0x5CC,
+    0x4EC, 0x4E6, 0x672, 0x65C, 0x64E, 0x6E4, 0x674, 0x76E,
+    0x74C, 0x72C, 0x726, 0x764, 0x734, 0x732, 0x6D8, 0x6C6,
+    0x636, 0x518, 0x458, 0x446, 0x588, 0x468, 0x462, 0x688,
+    0x628, 0x622, 0x5B8, 0x58E, 0x46E, 0x5D8, 0x5C6, 0x476,
+    0x776, 0x68E, 0x62E, 0x6E8, 0x6E2, 0x6EE, 0x758, 0x746,
+    0x716, 0x768, 0x762, 0x71A, 0x77A, 0x642, 0x78A, 0x530,
+    0x50C, 0x4B0, 0x486, 0x42C, 0x426, 0x590, 0x584, 0x4D0,
+    0x4C2, 0x434, 0x432, 0x612, 0x650, 0x7BA, 0x614, 0x47A,
+    0x53C, 0x4BC, 0x49E, 0x5E4, 0x4F4, 0x4F2, 0x7A4, 0x794,
+    0x792, 0x6DE, 0x6F6, 0x7B6, 0x578, 0x51E, 0x45E, 0x5E8,
+    0x5E2, 0x7A8, 0x7A2, 0x5DE, 0x5EE, 0x75E, 0x7AE, 0x684,
+    0x690, 0x69C, 0x18EB,
+};
+#define CODE128_CODE_C      99
+#define CODE128_CODE_B      100
+#define CODE128_CODE_A      101
+#define CODE128_START_A     103
+#define CODE128_START_B     104
+#define CODE128_START_C     105
+#define CODE128_STOP        106
+
+/******************************************************************************
+function: Modules of a QR code that are not function patterns, in bits
+parameter:
+    Version : 1 to QR_VERSION_MAX
+******************************************************************************/
+static UWORD Qr_RawModules(UBYTE Version)
+{
+    UWORD Modules = (16 * Version + 128) * Version + 64;
+    UBYTE Align;
+
+    if(Version >= 2) {
+        Align = Version / 7 + 2;
+        Modules -= (25 * Align - 10) * Align - 55;
+        if(Version >= 7)
+            Modules -= 36;
+    }
+    return Modules;
+}
+
+// Data codewords of a version at a level
+static UWORD Qr_DataCodewords(UBYTE Version, QR_ECC Ecc)
+{
+    return Qr_RawModules(Version) / 8 - Qr_EccPerBlock[Ecc][Version] * Qr_Blocks[Ecc][Version];
+}
+
+// Smallest version that holds Length bytes, 0 when none does
+static UBYTE Qr_Version(UWORD Length, QR_ECC Ecc)
+{
+    UBYTE Version;
+
+    if(Ecc > QR_ECC_H)
+        return 0;
+    for(Version = 1; Version <= QR_VERSION_MAX; Version++) {
+        // Mode, character count and the bytes
+        if(4 + ((Version < 10)? 8: 16) + 8 * (UDOUBLE)Length <= Qr_DataCodewords(Version, Ecc) * 8)
+            return Version;
+    }
+    return 0;
+}
+
+static UBYTE Qr_Get(const UBYTE *Bits, UBYTE Size, UBYTE X, UBYTE Y)
+{
+    UWORD Bit = (UWORD)Y * Size + X;
+    return (Bits[Bit >> 3] >> (7 - (Bit & 7))) & 1;
+}
+
+static void Qr_Set(UBYTE *Bits, UBYTE Size, UBYTE X, UBYTE Y, UBYTE Set)
+{
+    UWORD Bit = (UWORD)Y * Size + X;
+
+    if(Set)
+        Bits[Bit >> 3] |= 0x80 >> (Bit & 7);
+    else
+        Bits[Bit >> 3] &= ~(0x80 >> (Bit & 7));
+}
+
+// A module of a function pattern, masking and the codewords leave it alone
+static void Qr_SetFunction(QR_WORKSPACE *Work, UBYTE Size, int X, int Y, UBYTE Dark)
+{
+    if(X < 0 || Y < 0 || X >= Size || Y >= Size)
+        return;
+    Qr_Set(Work->Modules, Size, X, Y, Dark);
+    Qr_Set(Work->Function, Size, X, Y, 1);
+}
+
+/******************************************************************************
+function: Multiply in GF(256) with the QR polynomial x^8 + x^4 + x^3 + x^2 + 1
+******************************************************************************/
+static UBYTE Qr_Multiply(UBYTE X, UBYTE Y)
+{
+    UWORD Product = 0;
+    int i;
+
+    for(i = 7; i >= 0; i--) {
+        Product = (Product << 1) ^ ((Product >> 7) * 0x11D);
+        Product ^= ((Y >> i) & 1) * X;
+    }
+    return Product;
+}
+
+/******************************************************************************
+function: Write the format bits, both copies
+parameter:
+    Size : Modules per side
+    Ecc  : Error correction level
+    Mask : Mask pattern, 0 to 7
+info:
+    5 data bits and a BCH(15, 5) remainder, XORed with 0x5412. The dark
+    module next to the lower left copy is written with them
+******************************************************************************/
+static void Qr_DrawFormat(QR_WORKSPACE *Work, UBYTE Size, QR_ECC Ecc, UBYTE Mask)
+{
+    UWORD Data = Qr_EccFormat[Ecc] << 3 | Mask;
+    UWORD Remainder = Data, Bits;
+    int i;
+
+    for(i = 0; i < 10; i++)
+        Remainder = (Remainder << 1) ^ ((Remainder >> 9) * 0x537);
+    Bits = (Data << 10 | Remainder) ^ 0x5412;
+
+    for(i = 0; i <= 5; i++)
+        Qr_SetFunction(Work, Size, 8, i, (Bits >> i) & 1);
+    Qr_SetFunction(Work, Size, 8, 7, (Bits >> 6) & 1);
+    Qr_SetFunction(Work, Size, 8, 8, (Bits >> 7) & 1);
+    Qr_SetFunction(Work, Size, 7, 8, (Bits >> 8) & 1);
+    for(i = 9; i < 15; i++)
+        Qr_SetFunction(Work, Size, 14 - i, 8, (Bits >> i) & 1);
+
+    for(i = 0; i < 8; i++)
+        Qr_SetFunction(Work, Size, Size - 1 - i, 8, (Bits >> i) & 1);
+    for(i = 8; i < 15; i++)
+        Qr_SetFunction(Work, Size, 8, Size - 15 + i, (Bits >> i) & 1);
+    Qr_SetFunction(Work, Size, 8, Size - 8, 1);
+}
+
+/******************************************************************************
+function: Draw the function patterns of a version
+info:
+    Timing patterns, the three finders with their separators, the
+    alignment patterns, the format area and from version 7 on the two
+    copies of the version bits
+******************************************************************************/
+static void Qr_DrawFunctions(QR_WORKSPACE *Work, UBYTE Version)
+{
+    UBYTE Size = QR_SIZE(Version);
+    UBYTE Align = (Version == 1)? 0: Version / 7 + 2;
+    UBYTE Positions[QR_VERSION_MAX / 7 + 2];
+    UBYTE Step, i, j;
+    UDOUBLE Bits;
+    int Dx, Dy, Distance, Corner;
+
+    memset(Work->Modules, 0, QR_MODULE_BYTES);
+    memset(Work->Function, 0, QR_MODULE_BYTES);
+
+    for(i = 0; i < Size; i++) {
+        Qr_SetFunction(Work, Size, 6, i, i % 2 == 0);
+        Qr_SetFunction(Work, Size, i, 6, i % 2 == 0);
+    }
+
+    for(Corner = 0; Corner < 3; Corner++) {
+        int X = (Corner == 1)? Size - 4: 3;
+        int Y = (Corner == 2)? Size - 4: 3;
+        for(Dy = -4; Dy <= 4; Dy++) {
+            for(Dx = -4; Dx <= 4; Dx++) {
+                Distance = (Dx < 0)? -Dx: Dx;
+                if((Dy < 0)? -Dy > Distance: Dy > Distance)
+                    Distance = (Dy < 0)? -Dy: Dy;
+                Qr_SetFunction(Work, Size, X + Dx, Y + Dy, Distance != 2 && Distance != 4);
+            }
+        }
+    }
+
+    if(Align > 0) {
+        Step = (Version * 4 + Align * 2 + 1) / (Align * 2 - 2) * 2;
+        Positions[0] = 6;
+        for(i = Align - 1, j = Size - 7; i >= 1; i--, j -= Step)
+            Positions[i] = j;
+        for(i = 0; i < Align; i++) {
+            for(j = 0; j < Align; j++) {
+                // Not over the finders
+                if((i == 0 && j == 0) || (i == 0 && j == Align - 1) || (i == Align - 1 && j == 0))
+                    continue;
+                for(Dy = -2; Dy <= 2; Dy++) {
+                    for(Dx = -2; Dx <= 2; Dx++) {
+                        Distance = (Dx < 0)? -Dx: Dx;
+                        if((Dy < 0)? -Dy > Distance: Dy > Distance)
+                            Distance = (Dy < 0)? -Dy: Dy;
+                        Qr_SetFunction(Work, Size, Positions[i] + Dx, Positions[j] + Dy, Distance != 1);
+                    }
+                }
+            }
+        }
+    }
+
+    // Reserved for now, written again with the chosen mask
+    Qr_DrawFormat(Work, Size, QR_ECC_L, 0);
+
+    if(Version >= 7) {
+        Bits = Version;
+        for(i = 0; i < 12; i++)
+            Bits = (Bits << 1) ^ ((Bits >> 11) * 0x1F25);
+        Bits = (UDOUBLE)Version << 12 | Bits;
+        for(i = 0; i < 18; i++) {
+            Qr_SetFunction(Work, Size, Size - 11 + i % 3, i / 3, (Bits >> i) & 1);
+            Qr_SetFunction(Work, Size, i / 3, Size - 11 + i % 3, (Bits >> i) & 1);
+        }
+    }
+}
+
+/******************************************************************************
+function: Encode the payload into the codewords of the workspace
+parameter:
+    Data    : The payload
+    Length  : Bytes of the payload, fits in Version
+    Version : Version of the symbol
+    Ecc     : Error correction level
+info:
+    Byte mode, the terminator and the pad bytes fill the data codewords.
+    Each block gets its error correction codewords, the remainder of its
+    data divided by the generator polynomial, and the blocks are written
+    interleaved: the data codewords first, one from each block in turn,
+    then the error correction codewords the same way
+******************************************************************************/
+static void Qr_Encode(QR_WORKSPACE *Work, const UBYTE *Data, UWORD Length, UBYTE Version, QR_ECC Ecc)
+{
+    UWORD DataCodewords = Qr_DataCodewords(Version, Ecc);
+    UWORD Raw = Qr_RawModules(Version) / 8;
+    UBYTE Blocks = Qr_Blocks[Ecc][Version];
+    UBYTE EccLength = Qr_EccPerBlock[Ecc][Version];
+    UBYTE ShortBlocks = Blocks - Raw % Blocks;
+    UWORD ShortData = Raw / Blocks - EccLength;
+    UBYTE Divisor[QR_ECC_BLOCK_MAX], Remainder[QR_ECC_BLOCK_MAX];
+    UBYTE Root = 1, Factor, Byte, Block, k;
+    UDOUBLE Bit = 0, Value;
+    UWORD i, Offset = 0, BlockData;
+    int Count;
+
+    memset(Work->Data, 0, DataCodewords);
+    // Mode 0100, the count, then the bytes, MSB first
+    for(i = 0; i <= Length; i++) {
+        if(i == 0) {
+            Count = 4 + ((Version < 10)? 8: 16);
+            Value = 4UL << (Count - 4) | Length;
+        } else {
+            Count = 8;
+            Value = Data[i - 1];
+        }
+        while(Count-- > 0) {
+            if((Value >> Count) & 1)
+                Work->Data[Bit >> 3] |= 0x80 >> (Bit & 7);
+            Bit++;
+        }
+    }
+    // The terminator and the bits up to a byte are 0 already
+    for(i = (Bit + 4 + 7) / 8, Byte = 0xEC; i < DataCodewords; i++, Byte ^= 0xEC ^ 0x11)
+        Work->Data[i] = Byte;
+
+    memset(Divisor, 0, EccLength);
+    Divisor[EccLength - 1] = 1;
+    for(i = 0; i < EccLength; i++) {
+        for(k = 0; k < EccLength; k++) {
+            Divisor[k] = Qr_Multiply(Divisor[k], Root);
+            if(k + 1 < EccLength)
+                Divisor[k] ^= Divisor[k + 1];
+        }
+        Root = Qr_Multiply(Root, 0x02);
+    }
+
+    for(Block = 0; Block < Blocks; Block++) {
+        BlockData = ShortData + (Block >= ShortBlocks);
+        memset(Remainder, 0, EccLength);
+        for(i = 0; i < BlockData; i++) {
+            Byte = Work->Data[Offset + i];
+            if(i < ShortData)
+                Work->Codewords[i * Blocks + Block] = Byte;
+            else
+                Work->Codewords[ShortData * Blocks + Block - ShortBlocks] = Byte;
+            Factor = Byte ^ Remainder[0];
+            memmove(Remainder, Remainder + 1, EccLength - 1);
+            Remainder[EccLength - 1] = 0;
+            for(k = 0; k < EccLength; k++)
+                Remainder[k] ^= Qr_Multiply(Divisor[k], Factor);
+        }
+        for(i = 0; i < EccLength; i++)
+            Work->Codewords[DataCodewords + i * Blocks + Block] = Remainder[i];
+        Offset += BlockData;
+    }
+}
+
+/******************************************************************************
+function: Place the codewords in the modules that are not function patterns
+info:
+    Two columns at a time from the right, upwards and downwards in turn,
+    skipping the vertical timing pattern. Modules left over stay light
+******************************************************************************/
+static void Qr_DrawCodewords(QR_WORKSPACE *Work, UBYTE Version)
+{
+    UBYTE Size = QR_SIZE(Version);
+    UWORD Bits = Qr_RawModules(Version) / 8 * 8;
+    UWORD Bit = 0;
+    int Right, Vertical, j, X, Y;
+
+    for(Right = Size - 1; Right >= 1; Right -= 2) {
+        if(Right == 6)
+            Right = 5;
+        for(Vertical = 0; Vertical < Size; Vertical++) {
+            for(j = 0; j < 2; j++) {
+                X = Right - j;
+                Y = ((Right + 1) & 2)? Vertical: Size - 1 - Vertical;
+                if(Qr_Get(Work->Function, Size, X, Y) || Bit >= Bits)
+                    continue;
+                Qr_Set(Work->Modules, Size, X, Y, (Work->Codewords[Bit >> 3] >> (7 - (Bit & 7))) & 1);
+                Bit++;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+function: Invert the modules of a mask, applied twice it is undone
+******************************************************************************/
+static void Qr_ApplyMask(QR_WORKSPACE *Work, UBYTE Size, UBYTE Mask)
+{
+    UBYTE X, Y, Invert;
+
+    for(Y = 0; Y < Size; Y++) {
+        for(X = 0; X < Size; X++) {
+            switch(Mask) {
+            case 0:  Invert = (X + Y) % 2 == 0;                         break;
+            case 1:  Invert = Y % 2 == 0;                               break;
+            case 2:  Invert = X % 3 == 0;                               break;
+            case 3:  Invert = (X + Y) % 3 == 0;                         break;
+            case 4:  Invert = (X / 3 + Y / 2) % 2 == 0;                 break;
+            case 5:  Invert = X * Y % 2 + X * Y % 3 == 0;               break;
+            case 6:  Invert = (X * Y % 2 + X * Y % 3) % 2 == 0;         break;
+            default: Invert = ((X + Y) % 2 + X * Y % 3) % 2 == 0;       break;
+            }
+            if(Invert && !Qr_Get(Work->Function, Size, X, Y))
+                Qr_Set(Work->Modules, Size, X, Y, !Qr_Get(Work->Modules, Size, X, Y));
+        }
+    }
+}
+
+/******************************************************************************
+function: Penalty of a row or a column
+info:
+    3 for a run of 5 modules of one color and 1 for every module more, 40
+    for a 1:1:3:1:1 finder look-alike with 4 light modules on one side.
+    The quiet zone counts as light
+******************************************************************************/
+static UDOUBLE Qr_LinePenalty(QR_WORKSPACE *Work, UBYTE Size, UBYTE Line, UBYTE Vertical)
+{
+    UDOUBLE Penalty = 0;
+    UWORD Window = 0;
+    UBYTE Run = 0, Color = 2, Dark;
+    int i;
+
+    for(i = -4; i < Size + 4; i++) {
+        Dark = 0;
+        if(i >= 0 && i < Size) {
+            Dark = Vertical? Qr_Get(Work->Modules, Size, Line, i): Qr_Get(Work->Modules, Size, i, Line);
+            if(Dark == Color) {
+                Run++;
+                if(Run == 5)
+                    Penalty += 3;
+                else if(Run > 5)
+                    Penalty++;
+            } else {
+                Color = Dark;
+                Run = 1;
+            }
+        }
+        Window = ((Window << 1) | Dark) & 0x7FF;
+        if(i >= 6 && (Window == 0x5D0 || Window == 0x05D))
+            Penalty += 40;
+    }
+    return Penalty;
+}
+
+// Penalty of the whole symbol, the mask with the lowest one is kept
+static UDOUBLE Qr_Penalty(QR_WORKSPACE *Work, UBYTE Size)
+{
+    UDOUBLE Penalty = 0, Dark = 0, Total = (UDOUBLE)Size * Size;
+    UBYTE X, Y, Color;
+
+    for(Y = 0; Y < Size; Y++) {
+        Penalty += Qr_LinePenalty(Work, Size, Y, 0) + Qr_LinePenalty(Work, Size, Y, 1);
+        for(X = 0; X < Size; X++) {
+            Color = Qr_Get(Work->Modules, Size, X, Y);
+            Dark += Color;
+            if(X + 1 < Size && Y + 1 < Size && Color == Qr_Get(Work->Modules, Size, X + 1, Y) &&
+               Color == Qr_Get(Work->Modules, Size, X, Y + 1) && Color == Qr_Get(Work->Modules, Size, X + 1, Y + 1))
+                Penalty += 3;
+        }
+    }
+    // 10 for every 5% the dark modules are away from half
+    Dark = (Dark * 20 > Total * 10)? Dark * 20 - Total * 10: Total * 10 - Dark * 20;
+    return Penalty + ((Dark + Total - 1) / Total - 1) * 10;
+}
+
+/******************************************************************************
+function: Modules per side of the QR code of a payload
+parameter:
+    Length : Bytes of the payload
+    Ecc    : Error correction level
+info:
+    Returns 0 when the payload does not fit in QR_VERSION_MAX. The quiet
+    zone of QR_QUIET_ZONE modules on every side is not counted
+******************************************************************************/
+UBYTE Barcode_QRSize(UWORD Length, QR_ECC Ecc)
+{
+    UBYTE Version = Qr_Version(Length, Ecc);
+    return (Version == 0)? 0: QR_SIZE(Version);
+}
+
+/******************************************************************************
+function: Draw a QR code
+parameter:
+    Work             : Where the symbol is built, its contents do not matter
+    Xstart           : X coordinate of the top left of the quiet zone
+    Ystart           : Y coordinate of the top left of the quiet zone
+    Data             : The payload, any bytes
+    Length           : Bytes of the payload
+    Ecc              : Error correction level
+    Module           : Pixels per side of a module
+    Color_Foreground : Color of the dark modules
+    Color_Background : Color of the light modules and the quiet zone
+info:
+    Returns 0, or 1 when the payload does not fit or the symbol does not
+    fit in the coordinates. Draws (Barcode_QRSize + 2 * QR_QUIET_ZONE) *
+    Module pixels per side, so a new payload drawn at the same place
+    replaces the old one whatever their sizes
+******************************************************************************/
+UBYTE BarcodeCtx_DrawQR(PAINT *Ctx, QR_WORKSPACE *Work, UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length,
+                        QR_ECC Ecc, UBYTE Module, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE Version = Qr_Version(Length, Ecc);
+    UBYTE Size = QR_SIZE(Version);
+    UDOUBLE Side = (UDOUBLE)(Size + 2 * QR_QUIET_ZONE) * Module;
+    UDOUBLE Penalty, Lowest = 0xFFFFFFFF;
+    UBYTE Mask, Best = 0, X, Y, Run;
+    UWORD Xfirst = Xstart + QR_QUIET_ZONE * Module, Yfirst = Ystart + QR_QUIET_ZONE * Module;
+
+    if(Version == 0 || Module == 0 || Xstart + Side > 0xFFFF || Ystart + Side > 0xFFFF) {
+        Debug("Barcode_DrawQR Input parameter error\r\n");
+        return 1;
+    }
+
+    Qr_DrawFunctions(Work, Version);
+    Qr_Encode(Work, Data, Length, Version, Ecc);
+    Qr_DrawCodewords(Work, Version);
+    for(Mask = 0; Mask < 8; Mask++) {
+        Qr_ApplyMask(Work, Size, Mask);
+        Qr_DrawFormat(Work, Size, Ecc, Mask);
+        Penalty = Qr_Penalty(Work, Size);
+        if(Penalty < Lowest) {
+            Lowest = Penalty;
+            Best = Mask;
+        }
+        Qr_ApplyMask(Work, Size, Mask);
+    }
+    Qr_ApplyMask(Work, Size, Best);
+    Qr_DrawFormat(Work, Size, Ecc, Best);
+
+    PaintCtx_FillRect(Ctx, Xstart, Ystart, Xstart + Side, Ystart + Side, Color_Background);
+    for(Y = 0; Y < Size; Y++) {
+        for(X = 0; X < Size; X = Run) {
+            for(Run = X; Run < Size && Qr_Get(Work->Modules, Size, Run, Y); Run++)
+                ;
+            if(Run > X)
+                PaintCtx_FillRect(Ctx, Xfirst + X * Module, Yfirst + Y * Module,
+                                  Xfirst + Run * Module, Yfirst + (Y + 1) * Module, Color_Foreground);
+            else
+                Run++;
+        }
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Draw a QR code in the global Paint
+info:
+    See BarcodeCtx_DrawQR
+******************************************************************************/
+UBYTE Barcode_DrawQR(UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length, QR_ECC Ecc,
+                     UBYTE Module, UWORD Color_Foreground, UWORD Color_Background)
+{
+    return BarcodeCtx_DrawQR(&Paint, &Qr_Work, Xstart, Ystart, Data, Length, Ecc, Module, Color_Foreground, Color_Background);
+}
+
+// Digits in a row from Data[Start]
+static UWORD Code128_Digits(const UBYTE *Data, UWORD Length, UWORD Start)
+{
+    UWORD i;
+
+    for(i = Start; i < Length && Data[i] >= '0' && Data[i] <= '9'; i++)
+        ;
+    return i - Start;
+}
+
+/******************************************************************************
+function: Encode a payload into Code128 symbol values
+parameter:
+    Data   : The payload, ASCII 0 to 127
+    Length : Bytes of the payload, 1 to CODE128_LENGTH_MAX
+    Values : The start value, the data values and the check value,
+             room for 2 * CODE128_LENGTH_MAX + 2
+info:
+    Returns the number of values, 0 when the payload cannot be encoded.
+    Runs of digits go in code set C, two per value, when they start the
+    payload with 4 or more, end it with 4 or more or are 6 or more long.
+    The other bytes go in code set B, or A for control characters
+******************************************************************************/
+static UWORD Code128_Encode(const UBYTE *Data, UWORD Length, UBYTE *Values)
+{
+    UWORD Count = 0, i, Digits;
+    UBYTE Set;
+    UDOUBLE Sum;
+
+    if(Length == 0 || Length > CODE128_LENGTH_MAX)
+        return 0;
+    for(i = 0; i < Length; i++) {
+        if(Data[i] > 127)
+            return 0;
+    }
+
+    Digits = Code128_Digits(Data, Length, 0);
+    if(Digits >= 4 || (Digits == Length && Digits % 2 == 0)) {
+        Set = 'C';
+        Values[Count++] = CODE128_START_C;
+    } else {
+        Set = (Data[0] < ' ')? 'A': 'B';
+        Values[Count++] = (Set == 'A')? CODE128_START_A: CODE128_START_B;
+    }
+
+    for(i = 0; i < Length;) {
+        Digits = Code128_Digits(Data, Length, i);
+        if(Set == 'C') {
+            if(Digits >= 2) {
+                Values[Count++] = (Data[i] - '0') * 10 + Data[i + 1] - '0';
+                i += 2;
+                continue;
+            }
+            Set = (Data[i] < ' ')? 'A': 'B';
+            Values[Count++] = (Set == 'A')? CODE128_CODE_A: CODE128_CODE_B;
+            continue;
+        }
+        // An odd run starts with a digit in this set
+        if((Digits >= 6 || (Digits >= 4 && i + Digits == Length)) && Digits % 2 == 0) {
+            Set = 'C';
+            Values[Count++] = CODE128_CODE_C;
+            continue;
+        }
+        if(Set == 'A' && Data[i] >= '`') {
+            Set = 'B';
+            Values[Count++] = CODE128_CODE_B;
+        } else if(Set == 'B' && Data[i] < ' ') {
+            Set = 'A';
+            Values[Count++] = CODE128_CODE_A;
+        }
+        Values[Count++] = (Data[i] < ' ')? Data[i] + 64: Data[i] - ' ';
+        i++;
+    }
+
+    Sum = Values[0];
+    for(i = 1; i < Count; i++)
+        Sum += (UDOUBLE)i * Values[i];
+    Values[Count++] = Sum % 103;
+    return Count;
+}
+
+/******************************************************************************
+function: Modules of the Code128 symbol of a payload
+parameter:
+    Data   : The payload
+    Length : Bytes of the payload
+info:
+    Returns 0 when the payload cannot be encoded, see Code128_Encode.
+    The quiet zones of CODE128_QUIET_ZONE modules are not counted
+******************************************************************************/
+UWORD Barcode_Code128Width(const UBYTE *Data, UWORD Length)
+{
+    UBYTE Values[2 * CODE128_LENGTH_MAX + 2];
+    UWORD Count = Code128_Encode(Data, Length, Values);
+
+    return (Count == 0)? 0: Count * 11 + 13;
+}
+
+/******************************************************************************
+function: Draw a Code128 barcode
+parameter:
+    Xstart           : X coordinate of the left of the quiet zone
+    Ystart           : Y coordinate of the top of the bars
+    Data             : The payload, ASCII 0 to 127
+    Length           : Bytes of the payload, 1 to CODE128_LENGTH_MAX
+    Module           : Pixels per module, the width of the narrowest bar
+    Height           : Pixels per bar
+    Color_Foreground : Color of the bars
+    Color_Background : Color of the spaces and the quiet zones
+info:
+    Returns 0, or 1 when the payload cannot be encoded or the symbol does
+    not fit in the coordinates. Draws (Barcode_Code128Width + 2 *
+    CODE128_QUIET_ZONE) * Module x Height pixels
+******************************************************************************/
+UBYTE BarcodeCtx_DrawCode128(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length,
+                             UBYTE Module, UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE Values[2 * CODE128_LENGTH_MAX + 2];
+    UWORD Count = Code128_Encode(Data, Length, Values);
+    UDOUBLE Width = (UDOUBLE)(Count * 11 + 13 + 2 * CODE128_QUIET_ZONE) * Module;
+    UDOUBLE X = Xstart + CODE128_QUIET_ZONE * Module, Bar = 0;
+    UWORD Pattern, i;
+    int Bit, Bits;
+
+    if(Count == 0 || Module == 0 || Height == 0 || Xstart + Width > 0xFFFF || (UDOUBLE)Ystart + Height > 0xFFFF) {
+        Debug("Barcode_DrawCode128 Input parameter error\r\n");
+        return 1;
+    }
+
+    PaintCtx_FillRect(Ctx, Xstart, Ystart, Xstart + Width, Ystart + Height, Color_Background);
+    for(i = 0; i <= Count; i++) {
+        Pattern = Code128_Patterns[(i < Count)? Values[i]: CODE128_STOP];
+        Bits = (i < Count)? 11: 13;
+        for(Bit = Bits - 1; Bit >= 0; Bit--, X += Module) {
+            if((Pattern >> Bit) & 1) {
+                Bar += Module;
+                continue;
+            }
+            if(Bar > 0)
+                PaintCtx_FillRect(Ctx, X - Bar, Ystart, X, Ystart + Height, Color_Foreground);
+            Bar = 0;
+        }
+    }
+    // The stop pattern ends with a bar
+    PaintCtx_FillRect(Ctx, X - Bar, Ystart, X, Ystart + Height, Color_Foreground);
+    return 0;
+}
+
+/******************************************************************************
+function: Draw a Code128 barcode in the global Paint
+info:
+    See BarcodeCtx_DrawCode128
+******************************************************************************/
+UBYTE Barcode_DrawCode128(UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length,
+                          UBYTE Module, UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    return BarcodeCtx_DrawCode128(&Paint, Xstart, Ystart, Data, Length, Module, Height, Color_Foreground, Color_Background);
+}
@@ -0,0 +1,61 @@
+/*****************************************************************************
+* | File      	:   GUI_Barcode.h
+* | Function    :   Draw QR codes and Code128 barcodes into a paint image
+* | Info        :
+*   The symbols are generated on the device from a short payload, so a
+*   changed symbol is a few bytes to send instead of an image. QR codes
+*   are encoded in byte mode, versions 1 to QR_VERSION_MAX, with the
+*   smallest version the payload fits in at the requested error
+*   correction level. Code128 switches between code sets A, B and C to
+*   keep the symbol short. Every module is Module x Module pixels and is
+*   drawn with rectangle fills, a row of dark modules at a time.
+******************************************************************************/
+#ifndef __GUI_BARCODE_H
+#define __GUI_BARCODE_H
+
+#include "DEV_Config.h"
+#include "GUI_Paint.h"
+
+/**
+ * Error correction level of a QR code, the part of the symbol that can be restored
+**/
+typedef enum {
+    QR_ECC_L = 0,       // 7%
+    QR_ECC_M,           // 15%
+    QR_ECC_Q,           // 25%
+    QR_ECC_H,           // 30%
+} QR_ECC;
+
+#define QR_VERSION_MAX      10      // 57 x 57 modules, 271 bytes at QR_ECC_L, 119 at QR_ECC_H
+#define QR_SIZE(Version)    (17 + 4 * (Version))
+#define QR_SIZE_MAX         QR_SIZE(QR_VERSION_MAX)
+#define QR_MODULE_BYTES     ((QR_SIZE_MAX * QR_SIZE_MAX + 7) / 8)
+#define QR_CODEWORDS_MAX    346     // Data and error correction codewords of version 10
+#define QR_QUIET_ZONE       4       // Light modules around a QR code
+#define CODE128_LENGTH_MAX  80      // Longest Code128 payload
+#define CODE128_QUIET_ZONE  10      // Light modules left and right of a Code128 symbol
+
+/**
+ * Where a QR code is built before it is drawn, about 1.5 KB. Each caller
+ * that may draw at the same time as another needs its own
+**/
+typedef struct {
+    UBYTE Modules[QR_MODULE_BYTES];     // Set is dark
+    UBYTE Function[QR_MODULE_BYTES];    // Set where a function pattern is
+    UBYTE Data[QR_CODEWORDS_MAX];
+    UBYTE Codewords[QR_CODEWORDS_MAX];
+} QR_WORKSPACE;
+
+UBYTE Barcode_QRSize(UWORD Length, QR_ECC Ecc);
+UWORD Barcode_Code128Width(const UBYTE *Data, UWORD Length);
+
+UBYTE BarcodeCtx_DrawQR(PAINT *Ctx, QR_WORKSPACE *Work, UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length,
+                        QR_ECC Ecc, UBYTE Module, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE Barcode_DrawQR(UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length, QR_ECC Ecc,
+                     UBYTE Module, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE BarcodeCtx_DrawCode128(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length,
+                             UBYTE Module, UWORD Height, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE Barcode_DrawCode128(UWORD Xstart, UWORD Ystart, const UBYTE *Data, UWORD Length,
+                          UBYTE Module, UWORD Height, UWORD Color_Foreground, UWORD Color_Background);
+
+#endif
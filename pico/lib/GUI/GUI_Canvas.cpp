@@ -0,0 +1,29 @@
+/*****************************************************************************
+* | File      	:   GUI_Canvas.cpp
+* | Function    :   Pixel format kernels of the paint image, C tables
+* | Info        :
+*   Instantiates the kernels of GUI_Canvas.hpp for the scales that
+*   Paint_SetScale accepts.
+******************************************************************************/
+#include "GUI_Canvas.hpp"
+#include "GUI_Canvas.h"
+
+template <class Format>
+static constexpr CANVAS_FORMAT Canvas_Table()
+{
+    return {
+        Format::PixelsPerByte,
+        Canvas<Format>::PutPixel,
+        Canvas<Format>::FetchPixel,
+        Canvas<Format>::FillRows,
+        Canvas<Format>::Clear,
+    };
+}
+
+extern "C" {
+
+const CANVAS_FORMAT Canvas_1Bit = Canvas_Table<CanvasFormat<1>>();
+const CANVAS_FORMAT Canvas_2Bit = Canvas_Table<CanvasFormat<2>>();
+const CANVAS_FORMAT Canvas_4Bit = Canvas_Table<CanvasFormat<4>>();
+
+}
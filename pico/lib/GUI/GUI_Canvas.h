@@ -0,0 +1,35 @@
+/*****************************************************************************
+* | File      	:   GUI_Canvas.h
+* | Function    :   Pixel format kernels of the paint image, C interface
+* | Info        :
+*   One table of kernels per pixel format, built from the templates of
+*   GUI_Canvas.hpp. Paint_SetScale picks the table, drawing calls through
+*   it and never looks at the scale itself.
+******************************************************************************/
+#ifndef __GUI_CANVAS_H
+#define __GUI_CANVAS_H
+
+#include "DEV_Config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    UBYTE PixelsPerByte;
+    void (*PutPixel)(UBYTE *Image, UDOUBLE Index, UWORD Color);
+    // Pixel in the most significant bits
+    UWORD (*FetchPixel)(const UBYTE *Image, UDOUBLE Index);
+    void (*FillRows)(UBYTE *Image, UWORD WidthByte, UWORD X0, UWORD Y0, UWORD X1, UWORD Y1, UWORD Color);
+    void (*Clear)(UBYTE *Image, UDOUBLE Size, UWORD Color);
+} CANVAS_FORMAT;
+
+extern const CANVAS_FORMAT Canvas_1Bit;     // Scale 2, black and white
+extern const CANVAS_FORMAT Canvas_2Bit;     // Scale 4, 4 grays
+extern const CANVAS_FORMAT Canvas_4Bit;     // Scale 7, 7 colors
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
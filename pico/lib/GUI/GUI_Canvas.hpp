@@ -0,0 +1,127 @@
+/*****************************************************************************
+* | File      	:   GUI_Canvas.hpp
+* | Function    :   Pixel format kernels of the paint image
+* | Info        :
+*   One template per pixel format. The bits, masks and strides of the
+*   format are constants, so every format gets its own kernels without a
+*   branch on the scale. GUI_Canvas.cpp instantiates them into the
+*   CANVAS_FORMAT tables that GUI_Paint.c calls through, see GUI_Canvas.h.
+*   A new format is one more CanvasFormat and one more table.
+******************************************************************************/
+#ifndef __GUI_CANVAS_HPP
+#define __GUI_CANVAS_HPP
+
+#include "GUI_Paint.h"
+#include <string.h>
+
+/**
+ * A pixel format: pixels of BitsPerPixel bits, the first one in the
+ * most significant bits of a byte
+**/
+template <unsigned BitsPerPixel>
+struct CanvasFormat {
+    static_assert(BitsPerPixel == 1 || BitsPerPixel == 2 || BitsPerPixel == 4,
+                  "Pixels must fill whole bytes");
+
+    static constexpr unsigned Bits = BitsPerPixel;
+    static constexpr unsigned PixelsPerByte = 8 / Bits;
+    static constexpr unsigned IndexShift = (Bits == 1)? 3: (Bits == 2)? 2: 1;     // Index / PixelsPerByte
+    static constexpr UBYTE ValueMask = (1u << Bits) - 1;
+    static constexpr UBYTE FirstPixel = ValueMask << (8 - Bits);
+
+    // The pixel value of a paint color. Black and white only tell black
+    // from the rest, the gray formats keep the low bits
+    static constexpr UBYTE Value(UWORD Color)
+    {
+        return (Bits == 1)? ((Color == BLACK)? 0: 1): (Color & ValueMask);
+    }
+
+    // A byte of pixels, all of a paint color
+    static constexpr UBYTE Pattern(UWORD Color)
+    {
+        return Value(Color) * (0xFF / ValueMask);
+    }
+};
+
+/**
+ * The kernels of one pixel format. Images are rows of whole bytes
+**/
+template <class Format>
+struct Canvas {
+    /******************************************************************************
+    function: Write the pixel at an index of the image memory
+    parameter:
+        Image : Image memory
+        Index : Pixel number, counted row by row
+        Color : Painted colors
+    ******************************************************************************/
+    static void PutPixel(UBYTE *Image, UDOUBLE Index, UWORD Color)
+    {
+        UBYTE *Byte = &Image[Index >> Format::IndexShift];
+        unsigned Shift = (Index & (Format::PixelsPerByte - 1)) * Format::Bits;
+
+        *Byte = (*Byte & ~(Format::FirstPixel >> Shift)) |
+                ((UBYTE)(Format::Value(Color) << (8 - Format::Bits)) >> Shift);
+    }
+
+    /******************************************************************************
+    function: Read the pixel at an index of the image memory
+    info:
+        The value is in the most significant bits: 0x80 for white in black
+        and white
+    ******************************************************************************/
+    static UWORD FetchPixel(const UBYTE *Image, UDOUBLE Index)
+    {
+        unsigned Shift = (Index & (Format::PixelsPerByte - 1)) * Format::Bits;
+
+        return (UBYTE)(Image[Index >> Format::IndexShift] << Shift) & Format::FirstPixel;
+    }
+
+    /******************************************************************************
+    function: Fill a rectangle in image memory, rows of byte spans
+    parameter:
+        Image     : Image memory
+        WidthByte : Bytes per row
+        X0, Y0    : Top left pixel in memory, inclusive
+        X1, Y1    : Bottom right pixel in memory, inclusive
+        Color     : Painted colors
+    info:
+        The first and last byte of a row are masked, the bytes between are
+        written whole
+    ******************************************************************************/
+    static void FillRows(UBYTE *Image, UWORD WidthByte, UWORD X0, UWORD Y0, UWORD X1, UWORD Y1, UWORD Color)
+    {
+        const UBYTE Pattern = Format::Pattern(Color);
+        UDOUBLE First = X0 >> Format::IndexShift;
+        UDOUBLE Last = X1 >> Format::IndexShift;
+        UBYTE LeftMask = 0xFF >> (Format::Bits * (X0 & (Format::PixelsPerByte - 1)));
+        UBYTE RightMask = 0xFF << (Format::Bits * (Format::PixelsPerByte - 1 - (X1 & (Format::PixelsPerByte - 1))));
+        UBYTE *Row = Image + (UDOUBLE)Y0 * WidthByte;
+
+        if(First == Last)
+            LeftMask &= RightMask;
+
+        for(UWORD Y = Y0; Y <= Y1; Y++, Row += WidthByte) {
+            Row[First] = (Row[First] & ~LeftMask) | (Pattern & LeftMask);
+            if(First == Last)
+                continue;
+            if(Last > First + 1)
+                memset(&Row[First + 1], Pattern, Last - First - 1);
+            Row[Last] = (Row[Last] & ~RightMask) | (Pattern & RightMask);
+        }
+    }
+
+    /******************************************************************************
+    function: Fill the whole image memory with a color
+    parameter:
+        Image : Image memory
+        Size  : Bytes of the image
+        Color : Painted colors
+    ******************************************************************************/
+    static void Clear(UBYTE *Image, UDOUBLE Size, UWORD Color)
+    {
+        memset(Image, Format::Pattern(Color), Size);
+    }
+};
+
+#endif
@@ -0,0 +1,201 @@
+/*****************************************************************************
+* | File      	:   GUI_Dither.c
+* | Function    :   Dither 8 bit grayscale into a paint image
+* | Info        :
+*   Each output row is quantized left to right. Floyd-Steinberg and
+*   Atkinson keep the errors of the row being drawn and of the row below
+*   in two buffers that swap every row. The errors that Atkinson sends two
+*   rows down are kept in the slots of the current row that were already
+*   read, so two rows are enough for both.
+*   Black and white rows are packed into bits and blitted, 4 gray rows are
+*   set pixel by pixel.
+******************************************************************************/
+#include "GUI_Dither.h"
+#include "Debug.h"
+#include <string.h>
+
+#define DITHER_CHUNK    256     // Pixels per blit of a black and white row
+
+static const UBYTE Dither_Bayer[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+/******************************************************************************
+function: Start a dithered image
+parameter:
+    Dither    : State of the image, used by Dither_Row
+    Xstart    : X coordinate of the top left pixel
+    Ystart    : Y coordinate of the top left pixel
+    Width     : Source pixels per row
+    Height    : Source rows
+    Scale     : Every source pixel becomes Scale x Scale pixels, 1 to DITHER_SCALE_MAX
+    Mode      : Dithering mode
+    Error     : Memory for the errors, not needed by DITHER_BAYER
+    ErrorSize : Errors that fit in Error, see DITHER_ERROR_SIZE
+info:
+    Returns 0, or 1 when the parameters are invalid or Error is too small.
+    Draws in the levels of Ctx, set its scale before the rows come
+******************************************************************************/
+UBYTE DitherCtx_Start(PAINT *Ctx, DITHER *Dither, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height,
+                      UBYTE Scale, DITHER_MODE Mode, int16_t *Error, UDOUBLE ErrorSize)
+{
+    UDOUBLE OutputWidth = (UDOUBLE)Width * Scale;
+
+    if(Scale == 0 || Scale > DITHER_SCALE_MAX || Mode > DITHER_BAYER) {
+        Debug("Dither_Start Input parameter error\r\n");
+        return 1;
+    }
+    if(Mode != DITHER_BAYER && (Error == NULL || ErrorSize < DITHER_ERROR_SIZE(OutputWidth))) {
+        Debug("Dither_Start error memory too small\r\n");
+        return 1;
+    }
+
+    Dither->Ctx = Ctx;
+    Dither->Xstart = Xstart;
+    Dither->Ystart = Ystart;
+    Dither->Width = Width;
+    Dither->Height = Height;
+    Dither->Scale = Scale;
+    Dither->Mode = Mode;
+    Dither->Row = 0;
+    Dither->OutputRow = 0;
+    Dither->Error = Error;
+    if(Mode != DITHER_BAYER)
+        memset(Error, 0, DITHER_ERROR_SIZE(OutputWidth) * sizeof(int16_t));
+    return 0;
+}
+
+/******************************************************************************
+function: Start a dithered image in the global Paint
+info:
+    See DitherCtx_Start, select the image before the rows come
+******************************************************************************/
+UBYTE Dither_Start(DITHER *Dither, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height, UBYTE Scale,
+                   DITHER_MODE Mode, int16_t *Error, UDOUBLE ErrorSize)
+{
+    return DitherCtx_Start(&Paint, Dither, Xstart, Ystart, Width, Height, Scale, Mode, Error, ErrorSize);
+}
+
+/******************************************************************************
+function: Dither one row of the image
+parameter:
+    Dither : State of the image
+    Gray   : The source row, every pixel Scale times
+info:
+    The errors of this row are in This, one slot per pixel after a slot for
+    the pixel left of the row. Floyd-Steinberg sends 7/16 of the error
+    right and 3/16, 5/16 and 1/16 below. Atkinson sends 1/8 to the two
+    pixels right, the three below and the one two rows below.
+******************************************************************************/
+static void Dither_OutputRow(DITHER *Dither, const UBYTE *Gray)
+{
+    UDOUBLE Stride = (UDOUBLE)Dither->Width * Dither->Scale + 3;
+    int16_t *This = Dither->Error + (Dither->OutputRow & 1) * Stride;
+    int16_t *Next = Dither->Error + (~Dither->OutputRow & 1) * Stride;
+    const UBYTE *Bayer = Dither_Bayer[Dither->OutputRow & 7];
+    UDOUBLE Y = Dither->Ystart + Dither->OutputRow;
+    PAINT *Ctx = Dither->Ctx;
+    UBYTE Levels = (Ctx->Scale == 4)? 4: 2;
+    UBYTE Bits[DITHER_CHUNK / 8];
+    UDOUBLE Pixel = 0, ChunkStart = 0, X;
+    UWORD Source;
+    UBYTE Repeat, Level;
+    int Value, Error, Part;
+
+    Dither->OutputRow++;
+    // Rows below the image change nothing that is shown
+    if(Y >= Ctx->Height)
+        return;
+
+    memset(Bits, 0, sizeof(Bits));
+    for(Source = 0; Source < Dither->Width; Source++) {
+        for(Repeat = 0; Repeat < Dither->Scale; Repeat++, Pixel++) {
+            Value = Gray[Source];
+
+            if(Dither->Mode == DITHER_BAYER) {
+                Level = (Value * (Levels - 1) * 128 + (2 * Bayer[Pixel & 7] + 1) * 255) / (255 * 128);
+            } else {
+                Value += This[Pixel + 1];
+                Value = (Value < 0)? 0: (Value > 255)? 255: Value;
+                Level = (Levels == 2)? (Value >= 128): (Value * 3 + 127) / 255;
+                Error = Value - Level * 255 / (Levels - 1);
+
+                if(Dither->Mode == DITHER_FLOYD_STEINBERG) {
+                    // 7/16, then 3/9 of the 9/16 left, 5/6 of the 6/16 left and the rest
+                    This[Pixel + 1] = 0;
+                    Part = Error * 7 / 16;
+                    This[Pixel + 2] += Part;
+                    Error -= Part;
+                    Part = Error * 3 / 9;
+                    Next[Pixel] += Part;
+                    Error -= Part;
+                    Part = Error * 5 / 6;
+                    Next[Pixel + 1] += Part;
+                    Next[Pixel + 2] += Error - Part;
+                } else {
+                    Part = Error / 8;
+                    This[Pixel + 1] = Part;     // Two rows down
+                    This[Pixel + 2] += Part;
+                    This[Pixel + 3] += Part;
+                    Next[Pixel] += Part;
+                    Next[Pixel + 1] += Part;
+                    Next[Pixel + 2] += Part;
+                }
+            }
+
+            if(Levels == 4) {
+                X = Dither->Xstart + Pixel;
+                if(X < Ctx->Width)
+                    PaintCtx_SetPixel(Ctx, X, Y, Level);
+                continue;
+            }
+            if(Level == 0)
+                Bits[(Pixel - ChunkStart) >> 3] |= 0x80 >> ((Pixel - ChunkStart) & 7);
+            if(Pixel + 1 - ChunkStart == DITHER_CHUNK) {
+                X = Dither->Xstart + ChunkStart;
+                if(X < Ctx->Width)
+                    PaintCtx_BlitBitmap(Ctx, X, Y, Bits, DITHER_CHUNK, 1, sizeof(Bits), BLACK, WHITE, 0);
+                memset(Bits, 0, sizeof(Bits));
+                ChunkStart = Pixel + 1;
+            }
+        }
+    }
+    X = Dither->Xstart + ChunkStart;
+    if(Levels == 2 && Pixel > ChunkStart && X < Ctx->Width)
+        PaintCtx_BlitBitmap(Ctx, X, Y, Bits, Pixel - ChunkStart, 1, sizeof(Bits), BLACK, WHITE, 0);
+
+    // This becomes the row below, its slots outside the row start empty
+    if(Dither->Mode != DITHER_BAYER) {
+        This[0] = 0;
+        This[Stride - 2] = 0;
+        This[Stride - 1] = 0;
+    }
+}
+
+/******************************************************************************
+function: Dither the next source row
+parameter:
+    Dither : State of the image, from Dither_Start
+    Gray   : Width pixels, 0 black to 255 white
+info:
+    Draws Scale rows. Rows after the last one are ignored
+******************************************************************************/
+void Dither_Row(DITHER *Dither, const UBYTE *Gray)
+{
+    UBYTE Repeat;
+
+    if(Dither->Row >= Dither->Height) {
+        Debug("Dither_Row past the last row\r\n");
+        return;
+    }
+    for(Repeat = 0; Repeat < Dither->Scale; Repeat++)
+        Dither_OutputRow(Dither, Gray);
+    Dither->Row++;
+}
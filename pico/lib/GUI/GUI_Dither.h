@@ -0,0 +1,51 @@
+/*****************************************************************************
+* | File      	:   GUI_Dither.h
+* | Function    :   Dither 8 bit grayscale into a paint image
+* | Info        :
+*   Rows of gray come in one at a time, 0 black to 255 white, and are
+*   dithered to the levels of the image they are drawn in: black and
+*   white, or the 4 grays of scale 4. Every source pixel becomes Scale x
+*   Scale pixels, so a small upload fills a large area. The error
+*   diffusion modes keep two rows of errors, the memory comes from the
+*   caller.
+******************************************************************************/
+#ifndef __GUI_DITHER_H
+#define __GUI_DITHER_H
+
+#include "DEV_Config.h"
+#include "GUI_Paint.h"
+
+typedef enum {
+    DITHER_FLOYD_STEINBERG = 0,     // Error to the right and the row below
+    DITHER_ATKINSON,                // 3/4 of the error, over two rows, more contrast
+    DITHER_BAYER,                   // Ordered 8x8 threshold matrix, no error memory
+} DITHER_MODE;
+
+#define DITHER_SCALE_MAX    8
+
+// Errors needed for an output of OutputWidth pixels per row
+#define DITHER_ERROR_SIZE(OutputWidth)  (2 * ((UDOUBLE)(OutputWidth) + 3))
+
+/**
+ * A dithered image that is being received
+**/
+typedef struct {
+    PAINT *Ctx;         // The image the rows are drawn in
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Width;        // Source pixels per row
+    UWORD Height;       // Source rows
+    UBYTE Scale;
+    DITHER_MODE Mode;
+    UWORD Row;          // Next source row
+    UDOUBLE OutputRow;  // Next row of the image, counted from Ystart
+    int16_t *Error;     // Two rows of errors, see DITHER_ERROR_SIZE
+} DITHER;
+
+UBYTE DitherCtx_Start(PAINT *Ctx, DITHER *Dither, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height,
+                      UBYTE Scale, DITHER_MODE Mode, int16_t *Error, UDOUBLE ErrorSize);
+UBYTE Dither_Start(DITHER *Dither, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height, UBYTE Scale,
+                   DITHER_MODE Mode, int16_t *Error, UDOUBLE ErrorSize);
+void Dither_Row(DITHER *Dither, const UBYTE *Gray);
+
+#endif
@@ -85,6 +85,8 @@
 
 PAINT Paint;
 
+static void Paint_SetAddressing(PAINT *Ctx);
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -93,30 +95,32 @@ parameter:
     Height  :   The height of the picture
     Color   :   Whether the picture is inverted
 ******************************************************************************/
-void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+void PaintCtx_NewImage(PAINT *Ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
 {
-    Paint.Image = NULL;
-    Paint.Image = image;
+    Ctx->Image = NULL;
+    Ctx->Image = image;
 
-    Paint.WidthMemory = Width;
-    Paint.HeightMemory = Height;
-    Paint.Color = Color;    
-    Paint.Scale = 2;
-    Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
-    Paint.HeightByte = Height;    
-//    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
+    Ctx->WidthMemory = Width;
+    Ctx->HeightMemory = Height;
+    Ctx->Color = Color;    
+    Ctx->Scale = 2;
+    Ctx->WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
+    Ctx->HeightByte = Height;    
+//    printf("WidthByte = %d, HeightByte = %d\r\n", Ctx->WidthByte, Ctx->HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
-    Paint.Rotate = Rotate;
-    Paint.Mirror = MIRROR_NONE;
+    Ctx->Rotate = Rotate;
+    Ctx->Mirror = MIRROR_NONE;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
-        Paint.Width = Width;
-        Paint.Height = Height;
+        Ctx->Width = Width;
+        Ctx->Height = Height;
     } else {
-        Paint.Width = Height;
-        Paint.Height = Width;
+        Ctx->Width = Height;
+        Ctx->Height = Width;
     }
+    Paint_SetAddressing(Ctx);
+    PaintCtx_ResetDirty(Ctx);
 }
 
 /******************************************************************************
@@ -124,11 +128,13 @@ function: Select Image
 parameter:
     image : Pointer to the image cache
 ******************************************************************************/
-void Paint_SelectImage(UBYTE *image, UWORD Width, UWORD Height)
+void PaintCtx_SelectImage(PAINT *Ctx, UBYTE *image, UWORD Width, UWORD Height)
 {
-    Paint.Image = image;
-    Paint.WidthMemory = Width;
-    Paint.HeightMemory = Height;
+    Ctx->Image = image;
+    Ctx->WidthMemory = Width;
+    Ctx->HeightMemory = Height;
+    Paint_SetAddressing(Ctx);
+    PaintCtx_ResetDirty(Ctx);
 }
 
 /******************************************************************************
@@ -136,11 +142,12 @@ function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
 ******************************************************************************/
-void Paint_SetRotate(UWORD Rotate)
+void PaintCtx_SetRotate(PAINT *Ctx, UWORD Rotate)
 {
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         Debug("Set image Rotate %d\r\n", Rotate);
-        Paint.Rotate = Rotate;
+        Ctx->Rotate = Rotate;
+        Paint_SetAddressing(Ctx);
     } else {
         Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -151,204 +158,316 @@ function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
 ******************************************************************************/
-void Paint_SetMirroring(UBYTE mirror)
+void PaintCtx_SetMirroring(PAINT *Ctx, UBYTE mirror)
 {
     if(mirror == MIRROR_NONE || mirror == MIRROR_HORIZONTAL || 
         mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)? "mirror":"none");
-        Paint.Mirror = mirror;
+        Ctx->Mirror = mirror;
+        Paint_SetAddressing(Ctx);
     } else {
         Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
         MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }    
 }
 
-void Paint_SetScale(UBYTE scale)
+void PaintCtx_SetScale(PAINT *Ctx, UBYTE scale)
 {
     if(scale == 2){
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 8 == 0)? (Paint.WidthMemory / 8 ): (Paint.WidthMemory / 8 + 1);
+        Ctx->Scale = scale;
+        Ctx->WidthByte = (Ctx->WidthMemory % 8 == 0)? (Ctx->WidthMemory / 8 ): (Ctx->WidthMemory / 8 + 1);
     }else if(scale == 4){
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 4 == 0)? (Paint.WidthMemory / 4 ): (Paint.WidthMemory / 4 + 1);
+        Ctx->Scale = scale;
+        Ctx->WidthByte = (Ctx->WidthMemory % 4 == 0)? (Ctx->WidthMemory / 4 ): (Ctx->WidthMemory / 4 + 1);
     }else if(scale == 7){//Only applicable with 5in65 e-Paper
-		Paint.Scale = scale;
-		Paint.WidthByte = (Paint.WidthMemory % 2 == 0)? (Paint.WidthMemory / 2 ): (Paint.WidthMemory / 2 + 1);;
+		Ctx->Scale = scale;
+		Ctx->WidthByte = (Ctx->WidthMemory % 2 == 0)? (Ctx->WidthMemory / 2 ): (Ctx->WidthMemory / 2 + 1);;
 	}else{
         Debug("Set Scale Input parameter error\r\n");
         Debug("Scale Only support: 2 4 7\r\n");
+        return;
     }
+    Paint_SetAddressing(Ctx);
 }
 /******************************************************************************
-function: Draw Pixels
-parameter:
-    Xpoint : At point X
-    Ypoint : At point Y
-    Color  : Painted colors
+function: Resolve rotation, mirroring and scale into the pixel addressing
+info:
+    Pixel (X, Y) is pixel Origin + X * StepX + Y * StepY of the image
+    memory, counted row by row, for X < XLimit and Y < YLimit.
+    Called whenever the image, rotation, mirroring or scale changes, so
+    drawing does not look at them per pixel
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+static void Paint_SetAddressing(PAINT *Ctx)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }      
-    UWORD X, Y;
-    switch(Paint.Rotate) {
+    // Memory X = X0 + Xpoint * XX + Ypoint * YX, memory Y = Y0 + Xpoint * XY + Ypoint * YY
+    int32_t X0, Y0, XX, YX, XY, YY;
+    int32_t Right = Ctx->WidthMemory - 1;
+    int32_t Bottom = Ctx->HeightMemory - 1;
+    UWORD XLimit, YLimit;
+
+    if(Ctx->Scale == 4)
+        Ctx->Format = &Canvas_2Bit;
+    else if(Ctx->Scale == 7)
+        Ctx->Format = &Canvas_4Bit;
+    else
+        Ctx->Format = &Canvas_1Bit;
+    Ctx->RowPixels = Ctx->WidthByte * Ctx->Format->PixelsPerByte;
+    Ctx->PutPixel = Ctx->Format->PutPixel;
+    Ctx->FetchPixel = Ctx->Format->FetchPixel;
+
+    switch(Ctx->Rotate) {
     case 0:
-        X = Xpoint;
-        Y = Ypoint;  
+        X0 = 0;     XX = 1;     YX = 0;
+        Y0 = 0;     XY = 0;     YY = 1;
+        XLimit = Ctx->WidthMemory;
+        YLimit = Ctx->HeightMemory;
         break;
     case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
+        X0 = Right; XX = 0;     YX = -1;
+        Y0 = 0;     XY = 1;     YY = 0;
+        XLimit = Ctx->HeightMemory;
+        YLimit = Ctx->WidthMemory;
         break;
     case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
+        X0 = Right; XX = -1;    YX = 0;
+        Y0 = Bottom;XY = 0;     YY = -1;
+        XLimit = Ctx->WidthMemory;
+        YLimit = Ctx->HeightMemory;
         break;
     case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
+        X0 = 0;     XX = 0;     YX = 1;
+        Y0 = Bottom;XY = -1;    YY = 0;
+        XLimit = Ctx->HeightMemory;
+        YLimit = Ctx->WidthMemory;
         break;
     default:
-        return;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
+        X0 = Y0 = XX = YX = XY = YY = 0;
+        XLimit = YLimit = 0;
         break;
-    default:
+    }
+
+    if(Ctx->Mirror & MIRROR_HORIZONTAL) {
+        X0 = Right - X0;
+        XX = -XX;
+        YX = -YX;
+    }
+    if(Ctx->Mirror & MIRROR_VERTICAL) {
+        Y0 = Bottom - Y0;
+        XY = -XY;
+        YY = -YY;
+    }
+
+    Ctx->Origin = Y0 * (int32_t)Ctx->RowPixels + X0;
+    Ctx->StepX = XY * (int32_t)Ctx->RowPixels + XX;
+    Ctx->StepY = YY * (int32_t)Ctx->RowPixels + YX;
+    Ctx->XLimit = (Ctx->Width < XLimit)? Ctx->Width: XLimit;
+    Ctx->YLimit = (Ctx->Height < YLimit)? Ctx->Height: YLimit;
+
+    // Drawing starts unclipped
+    Ctx->ClipXstart = 0;
+    Ctx->ClipYstart = 0;
+    Ctx->ClipXend = Ctx->XLimit;
+    Ctx->ClipYend = Ctx->YLimit;
+    Ctx->ClipDepth = 0;
+}
+
+/******************************************************************************
+function: Restrict drawing to a rectangle
+parameter:
+    Xstart : x start point
+    Ystart : y start point
+    Xend   : x end point, not drawn
+    Yend   : y end point, not drawn
+info:
+    The new clip is the intersection with the current one, until the
+    matching Paint_PopClip. Every primitive clips its spans and glyph
+    rows to it once, instead of checking pixel by pixel. Selecting an
+    image or changing its rotation, mirroring or scale drops all clips
+******************************************************************************/
+void PaintCtx_PushClip(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if(Ctx->ClipDepth < PAINT_CLIP_DEPTH) {
+        Ctx->ClipStack[Ctx->ClipDepth][0] = Ctx->ClipXstart;
+        Ctx->ClipStack[Ctx->ClipDepth][1] = Ctx->ClipYstart;
+        Ctx->ClipStack[Ctx->ClipDepth][2] = Ctx->ClipXend;
+        Ctx->ClipStack[Ctx->ClipDepth][3] = Ctx->ClipYend;
+    } else {
+        Debug("Paint_PushClip Too many clips, drawing is not clipped further\r\n");
+        Ctx->ClipDepth++;
         return;
     }
+    Ctx->ClipDepth++;
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        Debug("Exceeding display boundaries\r\n");
+    if(Xstart > Ctx->ClipXstart)
+        Ctx->ClipXstart = Xstart;
+    if(Ystart > Ctx->ClipYstart)
+        Ctx->ClipYstart = Ystart;
+    if(Xend < Ctx->ClipXend)
+        Ctx->ClipXend = Xend;
+    if(Yend < Ctx->ClipYend)
+        Ctx->ClipYend = Yend;
+    // An empty clip draws nothing
+    if(Ctx->ClipXend < Ctx->ClipXstart)
+        Ctx->ClipXend = Ctx->ClipXstart;
+    if(Ctx->ClipYend < Ctx->ClipYstart)
+        Ctx->ClipYend = Ctx->ClipYstart;
+}
+
+/******************************************************************************
+function: Restore the clip from before the last Paint_PushClip
+******************************************************************************/
+void PaintCtx_PopClip(PAINT *Ctx)
+{
+    if(Ctx->ClipDepth == 0) {
+        Debug("Paint_PopClip No clip to pop\r\n");
         return;
     }
-    
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
-        if(Color == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-        else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }else if(Paint.Scale == 4){
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
-        Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata = Paint.Image[Addr];
-        
-        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));//Clear first, then set value
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    }else if(Paint.Scale == 7){
-		UDOUBLE Addr = X / 2  + Y * Paint.WidthByte;
-		UBYTE Rdata = Paint.Image[Addr];
-		Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
-		Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
-		// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);
-	}
+    Ctx->ClipDepth--;
+    if(Ctx->ClipDepth >= PAINT_CLIP_DEPTH)
+        return;
+
+    Ctx->ClipXstart = Ctx->ClipStack[Ctx->ClipDepth][0];
+    Ctx->ClipYstart = Ctx->ClipStack[Ctx->ClipDepth][1];
+    Ctx->ClipXend = Ctx->ClipStack[Ctx->ClipDepth][2];
+    Ctx->ClipYend = Ctx->ClipStack[Ctx->ClipDepth][3];
 }
 
+/******************************************************************************
+function: Grow the dirty region by a rectangle of the image memory
+parameter:
+    X0, Y0 : Top left pixel in memory, inclusive
+    X1, Y1 : Bottom right pixel in memory, inclusive
+******************************************************************************/
+static void Paint_MarkMemory(PAINT *Ctx, UWORD X0, UWORD Y0, UWORD X1, UWORD Y1)
+{
+    if(X0 < Ctx->DirtyXstart)
+        Ctx->DirtyXstart = X0;
+    if(Y0 < Ctx->DirtyYstart)
+        Ctx->DirtyYstart = Y0;
+    if(X1 >= Ctx->DirtyXend)
+        Ctx->DirtyXend = X1 + 1;
+    if(Y1 >= Ctx->DirtyYend)
+        Ctx->DirtyYend = Y1 + 1;
+}
 
 /******************************************************************************
-function: Get Pixels
+function: Grow the dirty region by a drawn rectangle
+parameter:
+    Xstart : x start point
+    Ystart : y start point
+    Xend   : x end point, included
+    Yend   : y end point, included
+info:
+    The rectangle lies inside the image. Rotation and mirroring map it to
+    the rectangle between its opposite corners in memory
+******************************************************************************/
+static void Paint_MarkArea(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UDOUBLE First = Ctx->Origin + Xstart * Ctx->StepX + Ystart * Ctx->StepY;
+    UDOUBLE Last = Ctx->Origin + Xend * Ctx->StepX + Yend * Ctx->StepY;
+    UWORD X0 = First % Ctx->RowPixels;
+    UWORD Y0 = First / Ctx->RowPixels;
+    UWORD X1 = Last % Ctx->RowPixels;
+    UWORD Y1 = Last / Ctx->RowPixels;
+
+    Paint_MarkMemory(Ctx, (X0 < X1)? X0: X1, (Y0 < Y1)? Y0: Y1, (X0 < X1)? X1: X0, (Y0 < Y1)? Y1: Y0);
+}
+
+/******************************************************************************
+function: The region of the image memory written since Paint_ResetDirty
+parameter:
+    Rect : Gets the region, widened to whole bytes
+info:
+    Every primitive grows the region by the rectangle it drew into, after
+    clipping. The coordinates are those of the image memory, as the panel
+    sees it, whatever the rotation and mirroring. Returns 0 when nothing
+    was drawn, Rect is then empty
+******************************************************************************/
+UBYTE PaintCtx_GetDirty(PAINT *Ctx, PAINT_RECT *Rect)
+{
+    UWORD PixelsPerByte = Ctx->Format->PixelsPerByte;
+
+    if(Ctx->DirtyXstart >= Ctx->DirtyXend || Ctx->DirtyYstart >= Ctx->DirtyYend) {
+        Rect->Xstart = Rect->Ystart = Rect->Xend = Rect->Yend = 0;
+        return 0;
+    }
+    Rect->Xstart = Ctx->DirtyXstart - Ctx->DirtyXstart % PixelsPerByte;
+    Rect->Ystart = Ctx->DirtyYstart;
+    Rect->Xend = Ctx->DirtyXend + (PixelsPerByte - Ctx->DirtyXend % PixelsPerByte) % PixelsPerByte;
+    Rect->Yend = Ctx->DirtyYend;
+    return 1;
+}
+
+/******************************************************************************
+function: Add a rectangle of the image memory to the dirty region
+parameter:
+    Xstart : x start point in memory
+    Ystart : y start point in memory
+    Xend   : x end point in memory, not included
+    Yend   : y end point in memory, not included
+info:
+    For writes that bypass Paint_*, such as an image received straight
+    into the memory. An empty rectangle is ignored
+******************************************************************************/
+void PaintCtx_MarkDirty(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+    Paint_MarkMemory(Ctx, Xstart, Ystart, Xend - 1, Yend - 1);
+}
+
+/******************************************************************************
+function: Start a new dirty region, once the panel shows the image
+info:
+    Selecting an image starts a new region as well
+******************************************************************************/
+void PaintCtx_ResetDirty(PAINT *Ctx)
+{
+    Ctx->DirtyXstart = 0xFFFF;
+    Ctx->DirtyYstart = 0xFFFF;
+    Ctx->DirtyXend = 0;
+    Ctx->DirtyYend = 0;
+}
+
+/******************************************************************************
+function: Draw Pixels
 parameter:
     Xpoint : At point X
     Ypoint : At point Y
     Color  : Painted colors
 ******************************************************************************/
-UWORD Paint_GetPixel(UWORD Xpoint, UWORD Ypoint)
+void PaintCtx_SetPixel(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
+    UDOUBLE Index;
 
-    UWORD pixelValue = 0;
-
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
+    if(Xpoint < Ctx->ClipXstart || Xpoint >= Ctx->ClipXend ||
+       Ypoint < Ctx->ClipYstart || Ypoint >= Ctx->ClipYend){
         Debug("Exceeding display boundaries\r\n");
-        return 0;
-    }      
-    UWORD X, Y;
-    switch(Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;  
-        break;
-    case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
-        break;
-    case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
-        break;
-    case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
-        break;
-    default:
-        return 0;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
-        return 0;
+        return;
     }
+    Index = Ctx->Origin + Xpoint * Ctx->StepX + Ypoint * Ctx->StepY;
+    Ctx->PutPixel(Ctx->Image, Index, Color);
+    Paint_MarkMemory(Ctx, Index % Ctx->RowPixels, Index / Ctx->RowPixels,
+                     Index % Ctx->RowPixels, Index / Ctx->RowPixels);
+}
+
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
+/******************************************************************************
+function: Get Pixels
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+info:
+    The pixel in the most significant bits: 0x80 for white, 0 for black in
+    black and white, the gray level << 6 in 4 gray
+******************************************************************************/
+UWORD PaintCtx_GetPixel(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint)
+{
+    if(Xpoint >= Ctx->XLimit || Ypoint >= Ctx->YLimit){
         Debug("Exceeding display boundaries\r\n");
         return 0;
     }
-    
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        
-        UBYTE data = Paint.Image[Addr];
-        pixelValue = (data << (X % 8)) & 0x80;
-        //UBYTE pixelValue = data & ~(0x80 >> (X % 8));
-        // if(Color == BLACK)
-        //     Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-        // else
-        //     Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }
-    
-    
-    // else if(Paint.Scale == 4){
-    //     UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
-    //     Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-    //     UBYTE Rdata = Paint.Image[Addr];
-        
-    //     Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));//Clear first, then set value
-    //     Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    // }else if(Paint.Scale == 7){
-	// 	UDOUBLE Addr = X / 2  + Y * Paint.WidthByte;
-	// 	UBYTE Rdata = Paint.Image[Addr];
-	// 	Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
-	// 	Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
-	// 	// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);
-	// }
-
-    return pixelValue;
+    return Ctx->FetchPixel(Ctx->Image, Ctx->Origin + Xpoint * Ctx->StepX + Ypoint * Ctx->StepY);
 }
 
 
@@ -358,24 +477,10 @@ function: Clear the color of the picture
 parameter:
     Color : Painted colors
 ******************************************************************************/
-void Paint_Clear(UWORD Color)
-{	
-	if(Paint.Scale == 2 || Paint.Scale == 4){
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}		
-	}else if(Paint.Scale == 7){
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = (Color<<4)|Color;
-			}
-		}		
-	}
-
+void PaintCtx_Clear(PAINT *Ctx, UWORD Color)
+{
+    Ctx->Format->Clear(Ctx->Image, (UDOUBLE)Ctx->WidthByte * Ctx->HeightByte, Color);
+    Paint_MarkMemory(Ctx, 0, 0, Ctx->RowPixels - 1, Ctx->HeightByte - 1);
 }
 
 /******************************************************************************
@@ -387,14 +492,98 @@ parameter:
     Yend   : y end point
     Color  : Painted colors
 ******************************************************************************/
-void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+void PaintCtx_ClearWindows(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
+    PaintCtx_FillRect(Ctx, Xstart, Ystart, Xend, Yend, Color);
+}
+
+/******************************************************************************
+function: Fill a rectangle in image memory, rows of byte spans
+parameter:
+    X0, Y0 : Top left pixel in memory, inclusive
+    X1, Y1 : Bottom right pixel in memory, inclusive
+    Color  : Painted colors
+info:
+    The kernel of the pixel format, see GUI_Canvas.hpp
+******************************************************************************/
+static void Paint_FillMemory(PAINT *Ctx, UWORD X0, UWORD Y0, UWORD X1, UWORD Y1, UWORD Color)
+{
+    Ctx->Format->FillRows(Ctx->Image, Ctx->WidthByte, X0, Y0, X1, Y1, Color);
+}
+
+/******************************************************************************
+function: Fill a rectangle
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not filled
+    Yend   : y end point, not filled
+    Color  : Painted colors
+info:
+    Clipped to the clip rectangle. Rotation and mirroring map the rectangle to
+    another rectangle in memory, which is filled as byte spans
+******************************************************************************/
+void PaintCtx_FillRect(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    UDOUBLE First, Last;
+    UWORD X0, Y0, X1, Y1, Swap;
+
+    if(Xstart < Ctx->ClipXstart)
+        Xstart = Ctx->ClipXstart;
+    if(Ystart < Ctx->ClipYstart)
+        Ystart = Ctx->ClipYstart;
+    if(Xend > Ctx->ClipXend)
+        Xend = Ctx->ClipXend;
+    if(Yend > Ctx->ClipYend)
+        Yend = Ctx->ClipYend;
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    // Opposite corners in memory
+    First = Ctx->Origin + Xstart * Ctx->StepX + Ystart * Ctx->StepY;
+    Last = Ctx->Origin + (Xend - 1) * Ctx->StepX + (Yend - 1) * Ctx->StepY;
+    X0 = First % Ctx->RowPixels;
+    Y0 = First / Ctx->RowPixels;
+    X1 = Last % Ctx->RowPixels;
+    Y1 = Last / Ctx->RowPixels;
+
+    if(X0 > X1) {
+        Swap = X0;
+        X0 = X1;
+        X1 = Swap;
     }
+    if(Y0 > Y1) {
+        Swap = Y0;
+        Y0 = Y1;
+        Y1 = Swap;
+    }
+
+    Paint_FillMemory(Ctx, X0, Y0, X1, Y1, Color);
+    Paint_MarkMemory(Ctx, X0, Y0, X1, Y1);
+}
+
+/******************************************************************************
+function: Fill a rectangle given by signed, inclusive coordinates
+parameter:
+    Xstart : x start point, may lie left of the image
+    Ystart : y start point, may lie above the image
+    Xend   : x end point, filled
+    Yend   : y end point, filled
+    Color  : Painted colors
+******************************************************************************/
+static void Paint_FillArea(PAINT *Ctx, int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
+{
+    if(Xstart < Ctx->ClipXstart)
+        Xstart = Ctx->ClipXstart;
+    if(Ystart < Ctx->ClipYstart)
+        Ystart = Ctx->ClipYstart;
+    if(Xend >= Ctx->ClipXend)
+        Xend = Ctx->ClipXend - 1;
+    if(Yend >= Ctx->ClipYend)
+        Yend = Ctx->ClipYend - 1;
+    if(Xstart > Xend || Ystart > Yend)
+        return;
+    PaintCtx_FillRect(Ctx, Xstart, Ystart, Xend + 1, Yend + 1, Color);
 }
 
 /******************************************************************************
@@ -406,31 +595,194 @@ parameter:
     Dot_Pixel	: point size
     Dot_Style	: point Style
 ******************************************************************************/
-void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
-                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+void PaintCtx_DrawPoint(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                        DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
+    // The square of the point, clipped
+    int Xstart = Xpoint - ((Dot_Style == DOT_FILL_AROUND)? (int)Dot_Pixel: 1);
+    int Ystart = Ypoint - ((Dot_Style == DOT_FILL_AROUND)? (int)Dot_Pixel: 1);
+    int Xend = Xpoint + Dot_Pixel - 1;
+    int Yend = Ypoint + Dot_Pixel - 1;
+
+    if (Xend - Xstart == 1 && Xstart >= 0 && Ystart >= 0) {
+        PaintCtx_SetPixel(Ctx, Xstart, Ystart, Color);
         return;
     }
+    Paint_FillArea(Ctx, Xstart, Ystart, Xend - 1, Yend - 1, Color);
+}
 
-    int16_t XDir_Num , YDir_Num;
-    if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if(Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
+/******************************************************************************
+function: Fill a span along or across a horizontal or vertical line
+parameter:
+    Vertical : P runs along Y, else along X
+    Pstart   : Start along the line
+    Pend     : End along the line, not filled
+    Qstart   : Start across the line
+    Qend     : End across the line, not filled
+    Color    : Painted colors
+******************************************************************************/
+static void Paint_FillLineSpan(PAINT *Ctx, UBYTE Vertical, int Pstart, int Pend, int Qstart, int Qend, UWORD Color)
+{
+    if(Vertical)
+        Paint_FillArea(Ctx, Qstart, Pstart, Qend - 1, Pend - 1, Color);
+    else
+        Paint_FillArea(Ctx, Pstart, Qstart, Pend - 1, Qend - 1, Color);
+}
+
+/******************************************************************************
+function: Draw a horizontal or vertical line
+parameter:
+    Vertical   : The line runs along Y, else along X
+    Pstart     : Starting coordinate along the line
+    Pend       : End coordinate along the line, drawn
+    Q          : Coordinate across the line
+    Color      : The color of the line segment
+    Line_width : Line width
+    Line_Style : Solid and dotted lines
+info:
+    Draws what the point by point loop of Paint_DrawLine draws, as spans.
+    A point of Line_width covers -Line_width .. Line_width - 2 around it,
+    clipped. Dotted lines paint
+    every third point with the background, so a pixel gets the color of
+    the last point that covers it
+******************************************************************************/
+static void Paint_DrawStraightLine(PAINT *Ctx, UBYTE Vertical, UWORD Pstart, UWORD Pend, UWORD Q,
+                                   UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    int Width = Line_width;
+    int Plow = (Pstart < Pend)? Pstart: Pend;
+    int Phigh = (Pstart < Pend)? Pend: Pstart;
+    int Qstart = Q - Width;
+    int Qend = Q + Width - 1;
+    int P, Plast, Last, Run;
+    UWORD RunColor, PixelColor;
+
+    P = Plow - Width;
+    Plast = Phigh + Width - 2;
+
+    if(Line_Style != LINE_STYLE_DOTTED) {
+        Paint_FillLineSpan(Ctx, Vertical, P, Plast + 1, Qstart, Qend, Color);
+        return;
+    }
+
+    // Only the part inside the clip
+    if(P < (Vertical? Ctx->ClipYstart: Ctx->ClipXstart))
+        P = Vertical? Ctx->ClipYstart: Ctx->ClipXstart;
+    if(Plast >= (Vertical? Ctx->ClipYend: Ctx->ClipXend))
+        Plast = (Vertical? Ctx->ClipYend: Ctx->ClipXend) - 1;
+
+    Run = P;
+    RunColor = Color;
+    for(; P <= Plast; P++) {
+        // The last point that covers P
+        if(Pend >= Pstart)
+            Last = (P + Width < Phigh)? P + Width: Phigh;
+        else
+            Last = (P - Width + 2 > Plow)? P - Width + 2: Plow;
+        PixelColor = (abs(Last - (int)Pstart) % 3 == 2)? IMAGE_BACKGROUND: Color;
+
+        if(PixelColor != RunColor) {
+            Paint_FillLineSpan(Ctx, Vertical, Run, P, Qstart, Qend, RunColor);
+            Run = P;
+            RunColor = PixelColor;
         }
-    } else {
-        for (XDir_Num = 0; XDir_Num <  Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num <  Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
+    }
+    Paint_FillLineSpan(Ctx, Vertical, Run, P, Qstart, Qend, RunColor);
+}
+
+/******************************************************************************
+function: Fill one row of a line from the runs that cover it
+parameter:
+    RunLow, RunHigh : Ring of the runs
+    First, Last     : The first and the last run that cover the row
+    Ypoint          : The row
+    Width           : Line width
+    Color           : The color of the line segment
+******************************************************************************/
+#define PAINT_LINE_RUNS     16
+
+static void Paint_FillLineRow(PAINT *Ctx, const int *RunLow, const int *RunHigh, int First, int Last,
+                              int Ypoint, int Width, UWORD Color)
+{
+    int Low = RunLow[First % PAINT_LINE_RUNS];
+    int High = RunHigh[First % PAINT_LINE_RUNS];
+
+    if (RunLow[Last % PAINT_LINE_RUNS] < Low)
+        Low = RunLow[Last % PAINT_LINE_RUNS];
+    if (RunHigh[Last % PAINT_LINE_RUNS] > High)
+        High = RunHigh[Last % PAINT_LINE_RUNS];
+
+    Paint_FillArea(Ctx, Low - Width, Ypoint, High + Width - 2, Ypoint, Color);
+}
+
+/******************************************************************************
+function: Draw a solid line of arbitrary slope as one span per row
+parameter:
+    Xstart ：Starting Xpoint point coordinates
+    Ystart ：Starting Xpoint point coordinates
+    Xend   ：End point Xpoint coordinate
+    Yend   ：End point Ypoint coordinate
+    Color  ：The color of the line segment
+    Line_width : Line width, at most DOT_PIXEL_8X8
+info:
+    Draws what stamping a point of Line_width at every step of the line
+    draws. The steps of one row form a run, and a point covers the rows
+    -Line_width .. Line_width - 2 around it, so a row of the stroke spans
+    the runs of up to 2 * Line_width - 1 rows. As both ends of the runs
+    move one way along the line, the outermost runs of that window give
+    the span. The last runs are kept in a ring
+******************************************************************************/
+static void Paint_DrawSlopedLine(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                                 UWORD Color, DOT_PIXEL Line_width)
+{
+    int RunLow[PAINT_LINE_RUNS], RunHigh[PAINT_LINE_RUNS];
+    int Width = Line_width;
+    int YAddway = Ystart < Yend ? 1 : -1;
+    // The runs a row needs, ahead along the line and behind
+    int Ahead = (YAddway > 0)? Width: Width - 2;
+    int Behind = (YAddway > 0)? Width - 2: Width;
+    int Run = 0, Row = -Ahead;
+
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+    int XAddway = Xstart < Xend ? 1 : -1;
+    int Esp = dx + dy;
+
+    RunLow[0] = RunHigh[0] = Xstart;
+    for (;;) {
+        if (Ypoint != Ystart + YAddway * Run) {
+            // Run is complete, and with it every row that needs no later run
+            for (; Row + Ahead <= Run; Row++)
+                Paint_FillLineRow(Ctx, RunLow, RunHigh, (Row - Behind > 0)? Row - Behind: 0, Row + Ahead,
+                                  Ystart + YAddway * Row, Width, Color);
+            Run++;
+            RunLow[Run % PAINT_LINE_RUNS] = RunHigh[Run % PAINT_LINE_RUNS] = Xpoint;
+        } else if (Xpoint < RunLow[Run % PAINT_LINE_RUNS]) {
+            RunLow[Run % PAINT_LINE_RUNS] = Xpoint;
+        } else if (Xpoint > RunHigh[Run % PAINT_LINE_RUNS]) {
+            RunHigh[Run % PAINT_LINE_RUNS] = Xpoint;
+        }
+
+        if (2 * Esp >= dy) {
+            if (Xpoint == Xend)
+                break;
+            Esp += dy;
+            Xpoint += XAddway;
+        }
+        if (2 * Esp <= dx) {
+            if (Ypoint == Yend)
+                break;
+            Esp += dx;
+            Ypoint += YAddway;
         }
     }
+
+    // The rows after the last run
+    for (; Row <= Run + Behind; Row++)
+        Paint_FillLineRow(Ctx, RunLow, RunHigh, (Row - Behind > 0)? Row - Behind: 0, (Row + Ahead < Run)? Row + Ahead: Run,
+                          Ystart + YAddway * Row, Width, Color);
 }
 
 /******************************************************************************
@@ -444,12 +796,22 @@ parameter:
     Line_width : Line width
     Line_Style: Solid and dotted lines
 ******************************************************************************/
-void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+void PaintCtx_DrawLine(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                       UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
+    if (Ystart == Yend) {
+        Paint_DrawStraightLine(Ctx, 0, Xstart, Xend, Ystart, Color, Line_width, Line_Style);
+        return;
+    }
+    if (Xstart == Xend) {
+        Paint_DrawStraightLine(Ctx, 1, Ystart, Yend, Xstart, Color, Line_width, Line_Style);
+        return;
+    }
+    // A thin line that is not flat has runs of a pixel or two, which the
+    // point by point loop below draws faster
+    if (Line_Style != LINE_STYLE_DOTTED && Line_width <= DOT_PIXEL_8X8 &&
+        (Line_width > DOT_PIXEL_1X1 || abs((int)Xend - (int)Xstart) >= 8 * abs((int)Yend - (int)Ystart))) {
+        Paint_DrawSlopedLine(Ctx, Xstart, Ystart, Xend, Yend, Color, Line_width);
         return;
     }
 
@@ -466,27 +828,43 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
     int Esp = dx + dy;
     char Dotted_Len = 0;
 
+    // A thin solid line inside the clip is written without a check per
+    // pixel, a point 1 x 1 is the pixel up and left of it
+    UBYTE Inside = (Line_width == DOT_PIXEL_1X1 && Line_Style != LINE_STYLE_DOTTED &&
+                    ((Xstart < Xend)? Xstart: Xend) > Ctx->ClipXstart &&
+                    ((Xstart < Xend)? Xend: Xstart) <= Ctx->ClipXend &&
+                    ((Ystart < Yend)? Ystart: Yend) > Ctx->ClipYstart &&
+                    ((Ystart < Yend)? Yend: Ystart) <= Ctx->ClipYend);
+    UDOUBLE Index = Ctx->Origin + (Xstart - 1) * Ctx->StepX + (Ystart - 1) * Ctx->StepY;
+
+    if (Inside)
+        Paint_MarkArea(Ctx, ((Xstart < Xend)? Xstart: Xend) - 1, ((Ystart < Yend)? Ystart: Yend) - 1,
+                       ((Xstart < Xend)? Xend: Xstart) - 1, ((Ystart < Yend)? Yend: Ystart) - 1);
     for (;;) {
         Dotted_Len++;
-        //Painted dotted line, 2 point is really virtual
-        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+        if (Inside) {
+            Ctx->PutPixel(Ctx->Image, Index, Color);
+        } else if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+            //Painted dotted line, 2 point is really virtual
             //Debug("LINE_DOTTED\r\n");
-            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            PaintCtx_DrawPoint(Ctx, Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
             Dotted_Len = 0;
         } else {
-            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+            PaintCtx_DrawPoint(Ctx, Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
         }
         if (2 * Esp >= dy) {
             if (Xpoint == Xend)
                 break;
             Esp += dy;
             Xpoint += XAddway;
+            Index += XAddway * Ctx->StepX;
         }
         if (2 * Esp <= dx) {
             if (Ypoint == Yend)
                 break;
             Esp += dx;
             Ypoint += YAddway;
+            Index += YAddway * Ctx->StepY;
         }
     }
 }
@@ -502,374 +880,2007 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the rectangle
 ******************************************************************************/
-void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+void PaintCtx_DrawRectangle(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                            UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Input exceeds the normal display range\r\n");
-        return;
-    }
-
     if (Draw_Fill) {
-        UWORD Ypoint;
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
-        }
+        // The area that one line per row, Ystart to Yend - 1, covers with
+        // points of Line_width: a point covers -Line_width .. Line_width - 2
+        int Xlow = (Xstart < Xend)? Xstart: Xend;
+        int Xhigh = (Xstart < Xend)? Xend: Xstart;
+        if (Ystart >= Yend)
+            return;
+        Xlow -= Line_width;
+        Xhigh += Line_width - 1;
+        int Ylow = Ystart - Line_width;
+        int Yhigh = Yend + Line_width - 2;
+        Paint_FillArea(Ctx, Xlow, Ylow, Xhigh - 1, Yhigh - 1, Color);
     } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
     }
 }
 
-/******************************************************************************
-function: Use the 8-point method to draw a circle of the
-            specified size at the specified position->
-parameter:
-    X_Center  ：Center X coordinate
-    Y_Center  ：Center Y coordinate
-    Radius    ：circle Radius
-    Color     ：The color of the ：circle segment
-    Line_width: Line width
-    Draw_Fill : Whether to fill the inside of the Circle
+#define PAINT_RADIUS_MAX    0x3FFF  // Keeps the ellipse arithmetic in 64 bits
+#define PAINT_SPAN_MAX      0x3FFFFFFF
+
+/**
+ * Angular range of an arc, the directions of its ends scaled by 16384
+**/
+typedef struct {
+    int32_t StartX, StartY;
+    int32_t EndX, EndY;
+    UBYTE Wide;             // More than 180 degrees
+} PAINT_SECTOR;
+
+// sin() of 0 .. 90 degrees, scaled by 16384
+static const UWORD Paint_SinTable[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+static int32_t Paint_Sin(UWORD Angle)
+{
+    Angle %= 360;
+    if(Angle <= 90)
+        return Paint_SinTable[Angle];
+    if(Angle <= 180)
+        return Paint_SinTable[180 - Angle];
+    if(Angle <= 270)
+        return -Paint_SinTable[Angle - 180];
+    return -Paint_SinTable[360 - Angle];
+}
+
+static UDOUBLE Paint_Sqrt(UDOUBLE Value)
+{
+    UDOUBLE Root = 0;
+    UDOUBLE Bit = (UDOUBLE)1 << 30;
+
+    while(Bit > Value)
+        Bit >>= 2;
+    while(Bit) {
+        if(Value >= Root + Bit) {
+            Value -= Root + Bit;
+            Root = (Root >> 1) + Bit;
+        } else {
+            Root >>= 1;
+        }
+        Bit >>= 2;
+    }
+    return Root;
+}
+
+static int32_t Paint_FloorDiv(int32_t Num, int32_t Den)
+{
+    return (Num >= 0)? Num / Den: -((-Num + Den - 1) / Den);
+}
+
+/******************************************************************************
+function: Is a pixel inside an ellipse
+parameter:
+    Dx, Dy  : The pixel, relative to the center
+    Xradius : Horizontal radius
+    Yradius : Vertical radius
+info:
+    The ellipse holds the pixels with
+    (Dx / (Xradius + 1/2))^2 + (Dy / (Yradius + 1/2))^2 <= 1, for a circle
+    that is Dx^2 + Dy^2 <= Radius^2 + Radius
 ******************************************************************************/
-void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
-                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+static UBYTE Paint_InEllipse(int Dx, int Dy, int Xradius, int Yradius)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
-        Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
-        return;
+    uint64_t A = 2 * Xradius + 1;
+    uint64_t B = 2 * Yradius + 1;
+
+    return 4 * (uint64_t)Dx * Dx * B * B + 4 * (uint64_t)Dy * Dy * A * A <= A * A * B * B;
+}
+
+/******************************************************************************
+function: The x of one row for which a * x + c >= 0
+parameter:
+    a, c   : The half plane
+    Lo, Hi : The range of x, Lo > Hi when there is none
+******************************************************************************/
+static void Paint_HalfPlane(int32_t a, int32_t c, int *Lo, int *Hi)
+{
+    *Lo = -PAINT_SPAN_MAX;
+    *Hi = PAINT_SPAN_MAX;
+    if(a > 0)
+        *Lo = -Paint_FloorDiv(c, a);
+    else if(a < 0)
+        *Hi = Paint_FloorDiv(c, -a);
+    else if(c < 0)
+        *Lo = PAINT_SPAN_MAX + 1;
+}
+
+/******************************************************************************
+function: The x of one row inside a sector
+parameter:
+    Sector : The sector, around 0, 0
+    Dy     : The row
+    Lo, Hi : Up to two ranges of x
+info:
+    A point p lies clockwise of the start direction S when S x p >= 0 and
+    counterclockwise of the end direction E when p x E >= 0. Up to 180
+    degrees the sector is where both hold, beyond it is everything but
+    where neither holds. Returns the number of ranges
+******************************************************************************/
+static UBYTE Paint_SectorRow(const PAINT_SECTOR *Sector, int Dy, int Lo[2], int Hi[2])
+{
+    int Lo1, Hi1, Lo2, Hi2;
+
+    if(!Sector->Wide) {
+        Paint_HalfPlane(-Sector->StartY, Sector->StartX * Dy, &Lo1, &Hi1);
+        Paint_HalfPlane(Sector->EndY, -Sector->EndX * Dy, &Lo2, &Hi2);
+        Lo[0] = (Lo1 > Lo2)? Lo1: Lo2;
+        Hi[0] = (Hi1 < Hi2)? Hi1: Hi2;
+        return 1;
     }
 
-    //Draw a circle from(0, R) as a starting point
-    int16_t XCurrent, YCurrent;
-    XCurrent = 0;
-    YCurrent = Radius;
+    Paint_HalfPlane(Sector->StartY, -Sector->StartX * Dy - 1, &Lo1, &Hi1);
+    Paint_HalfPlane(-Sector->EndY, Sector->EndX * Dy - 1, &Lo2, &Hi2);
+    if(Lo1 < Lo2)
+        Lo1 = Lo2;
+    if(Hi1 > Hi2)
+        Hi1 = Hi2;
+    Lo[0] = -PAINT_SPAN_MAX;
+    Hi[1] = PAINT_SPAN_MAX;
+    if(Lo1 > Hi1) {
+        Hi[0] = PAINT_SPAN_MAX;
+        return 1;
+    }
+    Hi[0] = Lo1 - 1;
+    Lo[1] = Hi1 + 1;
+    return 2;
+}
 
-    //Cumulative error,judge the next point of the logo
-    int16_t Esp = 3 - (Radius << 1 );
-
-    int16_t sCountY;
-    if (Draw_Fill == DRAW_FILL_FULL) {
-        while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            if (Esp < 0 )
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent );
-                YCurrent --;
-            }
-            XCurrent ++;
-        }
-    } else { //Draw a hollow circle
-        while (XCurrent <= YCurrent ) {
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
-
-            if (Esp < 0 )
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent );
-                YCurrent --;
-            }
-            XCurrent ++;
+/******************************************************************************
+function: Fill one row of a ring
+parameter:
+    Xcenter : Center of the ring
+    Ypoint  : The row
+    Dy      : The row, relative to the center
+    Outer   : Half width of the outer edge, nothing when negative
+    Inner   : Half width of the hole, no hole when negative
+    Sector  : Only the part inside it, or NULL
+    Color   : Painted colors
+******************************************************************************/
+static void Paint_FillRingRow(PAINT *Ctx, int Xcenter, int Ypoint, int Dy, int Outer, int Inner,
+                              const PAINT_SECTOR *Sector, UWORD Color)
+{
+    int Lo[2] = {-Outer, Inner + 1};
+    int Hi[2] = {(Inner < 0)? Outer: -Inner - 1, Outer};
+    int SectorLo[2] = {-Outer, 0};
+    int SectorHi[2] = {Outer, -1};
+    UBYTE Spans = (Inner < 0)? 1: 2;
+    UBYTE Ranges = 1;
+    UBYTE i, j;
+    int Start, End;
+
+    if(Outer < 0)
+        return;
+    if(Sector)
+        Ranges = Paint_SectorRow(Sector, Dy, SectorLo, SectorHi);
+
+    for(i = 0; i < Spans; i++) {
+        for(j = 0; j < Ranges; j++) {
+            Start = (Lo[i] > SectorLo[j])? Lo[i]: SectorLo[j];
+            End = (Hi[i] < SectorHi[j])? Hi[i]: SectorHi[j];
+            if(Start <= End)
+                Paint_FillArea(Ctx, Xcenter + Start, Ypoint, Xcenter + End, Ypoint, Color);
         }
     }
 }
 
 /******************************************************************************
-function: Show English characters
+function: Fill an ellipse, its outline or a sector of either, row by row
 parameter:
-    Xpoint           ：X coordinate
-    Ypoint           ：Y coordinate
-    Acsii_Char       ：To display the English characters
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Xcenter    : Center X coordinate
+    Ycenter    : Center Y coordinate
+    Xradius    : Horizontal radius of the middle of the outline
+    Yradius    : Vertical radius of the middle of the outline
+    Line_width : The outline covers Line_width - 1 outside and inside the
+                 radius, like a point of Line_width
+    Draw_Fill  : Fill the inside as well
+    Sector     : Only the part inside it, or NULL
+    Color      : Painted colors
+info:
+    The outline is the outer ellipse without the hole, so a thick outline
+    has the same width all around
 ******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
-                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+static void Paint_FillEllipse(PAINT *Ctx, int Xcenter, int Ycenter, int Xradius, int Yradius, int Line_width,
+                              DRAW_FILL Draw_Fill, const PAINT_SECTOR *Sector, UWORD Color)
 {
-    UWORD Page, Column;
+    int Xouter = Xradius + Line_width - 1;
+    int Youter = Yradius + Line_width - 1;
+    int Xinner = Xradius - Line_width;
+    int Yinner = Yradius - Line_width;
+    UBYTE Hole = (Draw_Fill != DRAW_FILL_FULL && Xinner >= 0 && Yinner >= 0);
+    int Dy, Outer, Inner;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
+    if(Xouter > PAINT_RADIUS_MAX || Youter > PAINT_RADIUS_MAX) {
+        Debug("Paint_FillEllipse Radius too large\r\n");
         return;
     }
 
-    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
+    // The half widths shrink from the middle row outwards
+    Outer = Xouter;
+    Inner = Hole? Xinner: -1;
+    for(Dy = 0; Dy <= Youter; Dy++) {
+        while(Outer >= 0 && !Paint_InEllipse(Outer, Dy, Xouter, Youter))
+            Outer--;
+        if(Dy > Yinner)
+            Inner = -1;
+        while(Inner >= 0 && !Paint_InEllipse(Inner, Dy, Xinner, Yinner))
+            Inner--;
+        if(Ycenter - Dy < Ctx->ClipYstart && Ycenter + Dy >= Ctx->ClipYend)
+            break;
+        if(Ycenter + Dy >= Ctx->ClipYstart && Ycenter - Dy < Ctx->ClipYend) {
+            Paint_FillRingRow(Ctx, Xcenter, Ycenter + Dy, Dy, Outer, Inner, Sector, Color);
+            if(Dy)
+                Paint_FillRingRow(Ctx, Xcenter, Ycenter - Dy, -Dy, Outer, Inner, Sector, Color);
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw the circle of the 8-point method as spans
+parameter:
+    Xcenter   : Center X coordinate
+    Ycenter   : Center Y coordinate
+    Radius    : circle Radius
+    Draw_Fill : Fill the inside, else a one pixel outline
+    Color     : Painted colors
+info:
+    Walks the octant like the point by point loop did. The points of a row
+    of the octant become one span, mirrored into the other octants; a
+    filled circle fills each row between its outermost points
+******************************************************************************/
+static void Paint_FillCircleRuns(PAINT *Ctx, int Xcenter, int Ycenter, int Radius, DRAW_FILL Draw_Fill, UWORD Color)
+{
+    int XCurrent = 0;
+    int YCurrent = Radius;
+    int Run = 0;
+
+    //Cumulative error,judge the next point of the logo
+    int Esp = 3 - 2 * Radius;
 
-    for (Page = 0; Page < Font->Height; Page ++ ) {
-        for (Column = 0; Column < Font->Width; Column ++ ) {
+    while (XCurrent <= YCurrent) {
+        if (Draw_Fill == DRAW_FILL_FULL) {
+            Paint_FillArea(Ctx, Xcenter - YCurrent, Ycenter + XCurrent, Xcenter + YCurrent, Ycenter + XCurrent, Color);
+            Paint_FillArea(Ctx, Xcenter - YCurrent, Ycenter - XCurrent, Xcenter + YCurrent, Ycenter - XCurrent, Color);
+        }
 
-            //To determine whether the font background color and screen background color is consistent
-            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+        // The row YCurrent of the octant ends here
+        if (Esp >= 0 || XCurrent >= YCurrent) {
+            if (Draw_Fill == DRAW_FILL_FULL) {
+                Paint_FillArea(Ctx, Xcenter - XCurrent, Ycenter + YCurrent, Xcenter + XCurrent, Ycenter + YCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter - XCurrent, Ycenter - YCurrent, Xcenter + XCurrent, Ycenter - YCurrent, Color);
             } else {
-                if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                }
+                Paint_FillArea(Ctx, Xcenter + Run, Ycenter + YCurrent, Xcenter + XCurrent, Ycenter + YCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter - XCurrent, Ycenter + YCurrent, Xcenter - Run, Ycenter + YCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter + Run, Ycenter - YCurrent, Xcenter + XCurrent, Ycenter - YCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter - XCurrent, Ycenter - YCurrent, Xcenter - Run, Ycenter - YCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter + YCurrent, Ycenter + Run, Xcenter + YCurrent, Ycenter + XCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter + YCurrent, Ycenter - XCurrent, Xcenter + YCurrent, Ycenter - Run, Color);
+                Paint_FillArea(Ctx, Xcenter - YCurrent, Ycenter + Run, Xcenter - YCurrent, Ycenter + XCurrent, Color);
+                Paint_FillArea(Ctx, Xcenter - YCurrent, Ycenter - XCurrent, Xcenter - YCurrent, Ycenter - Run, Color);
             }
-            //One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        }// Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    }// Write all
+            Run = XCurrent + 1;
+        }
+
+        if (Esp < 0 )
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent );
+            YCurrent --;
+        }
+        XCurrent ++;
+    }
 }
 
 /******************************************************************************
-function:	Display the string
+function: Use the 8-point method to draw a circle of the
+            specified size at the specified position->
 parameter:
-    Xstart           ：X coordinate
-    Ystart           ：Y coordinate
-    pString          ：The first address of the English string to be displayed
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    X_Center  ：Center X coordinate
+    Y_Center  ：Center Y coordinate
+    Radius    ：circle Radius
+    Color     ：The color of the ：circle segment
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the Circle
+info:
+    Like the points of the other shapes the circle lies one pixel up and
+    left of its center. Filled circles and one pixel outlines are the
+    pixels of the 8-point method, thicker outlines a ring of
+    2 * Line_width - 1 pixels around the radius
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
-                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+void PaintCtx_DrawCircle(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
-
-    if (Xstart > Paint.Width || Ystart > Paint.Height) {
-        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+    if (Radius > PAINT_RADIUS_MAX) {
+        Debug("Paint_DrawCircle Radius too large\r\n");
         return;
     }
 
-    while (* pString != '\0') {
-        //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width ) > Paint.Width ) {
-            Xpoint = Xstart;
-            Ypoint += Font->Height;
-        }
+    if (Draw_Fill == DRAW_FILL_FULL || Line_width <= DOT_PIXEL_1X1)
+        Paint_FillCircleRuns(Ctx, X_Center - 1, Y_Center - 1, Radius, Draw_Fill, Color);
+    else
+        Paint_FillEllipse(Ctx, X_Center - 1, Y_Center - 1, Radius, Radius, Line_width, DRAW_FILL_EMPTY, NULL, Color);
+}
 
-        // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint  + Font->Height ) > Paint.Height ) {
-            Xpoint = Xstart;
-            Ypoint = Ystart;
-        }
-        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Foreground, Color_Background);
+/******************************************************************************
+function: Draw an ellipse
+parameter:
+    X_Center  ：Center X coordinate
+    Y_Center  ：Center Y coordinate
+    X_Radius  ：Horizontal radius
+    Y_Radius  ：Vertical radius
+    Color     ：The color of the ellipse
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the ellipse
+info:
+    Lies one pixel up and left of its center, like Paint_DrawCircle
+******************************************************************************/
+void PaintCtx_DrawEllipse(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD X_Radius, UWORD Y_Radius,
+                          UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    Paint_FillEllipse(Ctx, X_Center - 1, Y_Center - 1, X_Radius, Y_Radius, Line_width, Draw_Fill, NULL, Color);
+}
 
-        //The next character of the address
-        pString ++;
+/******************************************************************************
+function: Draw an arc, or a pie slice
+parameter:
+    X_Center    ：Center X coordinate
+    Y_Center    ：Center Y coordinate
+    Radius      ：Arc radius
+    Start_Angle ：Start of the arc in degrees, 0 points right
+    End_Angle   ：End of the arc in degrees, clockwise from Start_Angle
+    Color       ：The color of the arc
+    Line_width  : Line width
+    Draw_Fill   : Fill the slice between the arc and the center
+info:
+    The ends of a thick arc are cut along the radius. An end angle of
+    360 or more past the start draws the whole circle
+******************************************************************************/
+void PaintCtx_DrawArc(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Start_Angle, UWORD End_Angle,
+                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PAINT_SECTOR Sector;
+    UWORD Sweep;
 
-        //The next word of the abscissa increases the font of the broadband
-        Xpoint += Font->Width;
+    if (End_Angle >= Start_Angle && End_Angle - Start_Angle >= 360) {
+        Paint_FillEllipse(Ctx, X_Center - 1, Y_Center - 1, Radius, Radius, Line_width, Draw_Fill, NULL, Color);
+        return;
     }
+
+    Start_Angle %= 360;
+    End_Angle %= 360;
+    Sweep = (End_Angle + 360 - Start_Angle) % 360;
+    if (Sweep == 0)
+        return;
+
+    Sector.StartX = Paint_Sin(Start_Angle + 90);
+    Sector.StartY = Paint_Sin(Start_Angle);
+    Sector.EndX = Paint_Sin(End_Angle + 90);
+    Sector.EndY = Paint_Sin(End_Angle);
+    Sector.Wide = (Sweep > 180);
+    Paint_FillEllipse(Ctx, X_Center - 1, Y_Center - 1, Radius, Radius, Line_width, Draw_Fill, &Sector, Color);
 }
 
+/******************************************************************************
+function: How far a row of a rounded box lies inside its straight sides
+parameter:
+    Ypoint : The row
+    Top    : First row of the box
+    Bottom : Last row of the box
+    Radius : Corner radius
+******************************************************************************/
+static int Paint_CornerInset(int Ypoint, int Top, int Bottom, int Radius)
+{
+    UDOUBLE Dy;
+
+    if (Ypoint < Top + Radius)
+        Dy = Top + Radius - Ypoint;
+    else if (Ypoint > Bottom - Radius)
+        Dy = Ypoint - Bottom + Radius;
+    else
+        return 0;
+    // The corner circle, see Paint_InEllipse
+    return Radius - (int)Paint_Sqrt((UDOUBLE)Radius * Radius + Radius - Dy * Dy);
+}
 
 /******************************************************************************
-function: Display the string
+function: Draw a rectangle with rounded corners
 parameter:
-    Xstart  ：X coordinate
-    Ystart  ：Y coordinate
-    pString ：The first address of the Chinese string and English
-              string to be displayed
-    Font    ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Xstart ：Rectangular  Starting Xpoint point coordinates
+    Ystart ：Rectangular  Starting Xpoint point coordinates
+    Xend   ：Rectangular  End point Xpoint coordinate
+    Yend   ：Rectangular  End point Ypoint coordinate
+    Radius ：Corner radius, at most half the shorter side
+    Color  ：The color of the Rectangular segment
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the rectangle
+info:
+    The straight sides cover the pixels of Paint_DrawRectangle's outline,
+    a filled one fills up to the outside of that outline
 ******************************************************************************/
-void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
-                        UWORD Color_Foreground, UWORD Color_Background)
+void PaintCtx_DrawRoundedRectangle(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius,
+                                   UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    const char* p_text = pString;
-    int x = Xstart, y = Ystart;
-    int i, j,Num;
+    // The middle of the outline, one pixel up and left like the points
+    int Left = ((Xstart < Xend)? Xstart: Xend) - 1;
+    int Right = ((Xstart < Xend)? Xend: Xstart) - 1;
+    int Top = ((Ystart < Yend)? Ystart: Yend) - 1;
+    int Bottom = ((Ystart < Yend)? Yend: Ystart) - 1;
+    int Width = Line_width;
+    int Edge = Width - 1;
+    int Corner = Radius;
+    int Inner, Ypoint, Yend_Row, Inset;
 
-    /* Send the string character by character on EPD */
-    while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if((*p_text== font->table[Num].index[0]) && (*(p_text+1) == font->table[Num].index[1])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 2;
-            /* Decrement the column position by 16 */
-            x += font->Width;
+    if (Corner > (Right - Left) / 2)
+        Corner = (Right - Left) / 2;
+    if (Corner > (Bottom - Top) / 2)
+        Corner = (Bottom - Top) / 2;
+    Inner = (Corner > Width)? Corner - Width: 0;
+
+    // The hole, when there is one
+    UBYTE Hole = (Draw_Fill != DRAW_FILL_FULL && Left + Width <= Right - Width && Top + Width <= Bottom - Width);
+
+    Ypoint = (Top - Edge < Ctx->ClipYstart)? Ctx->ClipYstart: Top - Edge;
+    Yend_Row = (Bottom + Edge >= Ctx->ClipYend)? Ctx->ClipYend - 1: Bottom + Edge;
+    for (; Ypoint <= Yend_Row; Ypoint++) {
+        Inset = Paint_CornerInset(Ypoint, Top - Edge, Bottom + Edge, Corner + Edge);
+        if (Hole && Ypoint >= Top + Width && Ypoint <= Bottom - Width) {
+            int Hole_Inset = Paint_CornerInset(Ypoint, Top + Width, Bottom - Width, Inner);
+            Paint_FillArea(Ctx, Left - Edge + Inset, Ypoint, Left + Width + Hole_Inset - 1, Ypoint, Color);
+            Paint_FillArea(Ctx, Right - Width - Hole_Inset + 1, Ypoint, Right + Edge - Inset, Ypoint, Color);
+        } else {
+            Paint_FillArea(Ctx, Left - Edge + Inset, Ypoint, Right + Edge - Inset, Ypoint, Color);
         }
     }
 }
 
 /******************************************************************************
-function:	Display nummber
+function: Draw connected lines
 parameter:
-    Xstart           ：X coordinate
-    Ystart           : Y coordinate
-    Nummber          : The number displayed
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Points     : The vertices
+    Count      : Number of vertices
+    Color      : The color of the lines
+    Line_width : Line width
+    Line_Style : Solid and dotted lines
+info:
+    The segments share their end points, so the square points of a thick
+    line close the joins
 ******************************************************************************/
-#define  ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
-                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+void PaintCtx_DrawPolyline(PAINT *Ctx, const PAINT_POINT *Points, UWORD Count,
+                           UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
 {
+    UWORD i;
 
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
+    if (Count == 1)
+        PaintCtx_DrawPoint(Ctx, Points[0].X, Points[0].Y, Color, Line_width, DOT_STYLE_DFT);
+    for (i = 1; i < Count; i++)
+        PaintCtx_DrawLine(Ctx, Points[i - 1].X, Points[i - 1].Y, Points[i].X, Points[i].Y, Color, Line_width, Line_Style);
+}
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DisNum Input exceeds the normal display range\r\n");
+/******************************************************************************
+function: Fill a polygon
+parameter:
+    Points    : The vertices, the last one connects to the first
+    Count     : Number of vertices, at most PAINT_POLYGON_EDGES
+    Color     : Painted colors
+    Fill_Rule : Where the edges cross, which parts are inside
+info:
+    Like the end points of Paint_DrawLine a vertex X, Y stands for the
+    pixel X - 1, Y - 1, so the outline of Paint_DrawPolygon lies on the
+    edges. A pixel is filled when its center lies inside, on the left and
+    top edges but not on the right and bottom ones, so polygons that share
+    an edge do not overlap.
+    Each row inside the clip collects the crossings of the edges that span
+    it, sorted, and fills between them. The crossings are kept on the
+    stack, so every call has its own
+******************************************************************************/
+void PaintCtx_FillPolygon(PAINT *Ctx, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    UWORD Crossings[PAINT_POLYGON_EDGES];   // First pixel right of the crossing, inside the clip
+    int8_t Windings[PAINT_POLYGON_EDGES];   // 1 when the edge runs down, -1 up
+    UWORD Found, i, j;
+    int x0, y0, x1, y1, Ypoint, Yfirst, Ylast;
+    int Winding, Start;
+    int64_t Run;
+    int32_t X;
+
+    if (Count > PAINT_POLYGON_EDGES) {
+        Debug("Paint_FillPolygon Too many vertices\r\n");
         return;
     }
+    if (Count == 0)
+        return;
 
-    //Converts a number to a string
-    while (Nummber) {
-        Num_Array[Num_Bit] = Nummber % 10 + '0';
-        Num_Bit++;
-        Nummber /= 10;
+    Yfirst = Ylast = Points[0].Y - 1;
+    for (i = 1; i < Count; i++) {
+        if (Points[i].Y - 1 < Yfirst)
+            Yfirst = Points[i].Y - 1;
+        if (Points[i].Y - 1 > Ylast)
+            Ylast = Points[i].Y - 1;
     }
+    if (Yfirst < Ctx->ClipYstart)
+        Yfirst = Ctx->ClipYstart;
+    if (Ylast > Ctx->ClipYend)
+        Ylast = Ctx->ClipYend;
 
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
+    for (Ypoint = Yfirst; Ypoint < Ylast; Ypoint++) {
+        // The crossings of this row, without the flat edges, by X
+        Found = 0;
+        for (i = 0; i < Count; i++) {
+            x0 = Points[i].X - 1;
+            y0 = Points[i].Y - 1;
+            x1 = Points[(i + 1) % Count].X - 1;
+            y1 = Points[(i + 1) % Count].Y - 1;
+            Winding = 1;
+            if (y0 > y1) {
+                Winding = -1;
+                Start = x0; x0 = x1; x1 = Start;
+                Start = y0; y0 = y1; y1 = Start;
+            }
+            if (Ypoint < y0 || Ypoint >= y1)
+                continue;
 
-    //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Foreground, Color_Background);
+            Run = (int64_t)(Ypoint - y0) * (x1 - x0);
+            X = x0 + (int32_t)(Run / (y1 - y0)) + (Run % (y1 - y0) > 0);
+            if (X < Ctx->ClipXstart)
+                X = Ctx->ClipXstart;
+            if (X > Ctx->ClipXend)
+                X = Ctx->ClipXend;
+
+            for (j = Found; j > 0 && Crossings[j - 1] > X; j--) {
+                Crossings[j] = Crossings[j - 1];
+                Windings[j] = Windings[j - 1];
+            }
+            Crossings[j] = X;
+            Windings[j] = Winding;
+            Found++;
+        }
+
+        Winding = 0;
+        Start = 0;
+        for (i = 0; i < Found; i++) {
+            if (Fill_Rule == FILL_RULE_NONZERO) {
+                if (Winding == 0)
+                    Start = Crossings[i];
+                Winding += Windings[i];
+                if (Winding == 0)
+                    Paint_FillArea(Ctx, Start, Ypoint, Crossings[i] - 1, Ypoint, Color);
+            } else if (i % 2 == 0) {
+                Start = Crossings[i];
+            } else {
+                Paint_FillArea(Ctx, Start, Ypoint, Crossings[i] - 1, Ypoint, Color);
+            }
+        }
+    }
 }
 
 /******************************************************************************
-function:	Display time
+function: Draw a polygon
 parameter:
-    Xstart           ：X coordinate
-    Ystart           : Y coordinate
-    pTime            : Time-related structures
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Points     : The vertices, the last one connects to the first
+    Count      : Number of vertices
+    Color      : The color of the polygon
+    Line_width : Line width
+    Draw_Fill  : Whether to fill the inside of the polygon
+info:
+    A filled polygon is filled by the even-odd rule and covers its
+    outline too, like a filled Paint_DrawRectangle
 ******************************************************************************/
-void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
-                    UWORD Color_Foreground, UWORD Color_Background)
+void PaintCtx_DrawPolygon(PAINT *Ctx, const PAINT_POINT *Points, UWORD Count,
+                          UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
-
-    UWORD Dx = Font->Width;
+    if (Count == 0)
+        return;
 
-    //Write data into the cache
-    Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+    if (Draw_Fill)
+        PaintCtx_FillPolygon(Ctx, Points, Count, Color, FILL_RULE_EVEN_ODD);
+    PaintCtx_DrawPolyline(Ctx, Points, Count, Color, Line_width, LINE_STYLE_SOLID);
+    if (Count > 2)
+        PaintCtx_DrawLine(Ctx, Points[Count - 1].X, Points[Count - 1].Y, Points[0].X, Points[0].Y,
+                          Color, Line_width, LINE_STYLE_SOLID);
 }
 
 /******************************************************************************
-function:	Display monochrome bitmap
+function: Write a row of 1 bit per pixel source bits to the image memory
 parameter:
-    image_buffer ：A picture data converted to a bitmap
+    Index       : Pixel index of the first pixel, see Paint_SetAddressing
+    Bits        : The row, MSB first, a set bit is foreground
+    Skip        : Bits of Bits[0] before the first pixel, 0 .. 7
+    Width       : Number of pixels, already clipped
+    Fore, Back  : Colors of the set and clear bits
+    Transparent : Leave the clear bits as they are
 info:
-    Use a computer to convert the image into a corresponding array,
-    and then embed the array directly into Imagedata.cpp as a .c file.
+    When the row runs left to right through the memory of a black and
+    white image, the source bits are shifted into the image bytes under a
+    mask, 24 at a time. Otherwise (90 and 270 rotation, 4 gray) the pixels
+    are written one by one, stepping through the memory
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char* image_buffer)
+static void Paint_BlitBits(PAINT *Ctx, UDOUBLE Index, const UBYTE *Bits, UBYTE Skip, UWORD Width,
+                           UWORD Fore, UWORD Back, UBYTE Transparent)
 {
-    UWORD x, y;
-    UDOUBLE Addr = 0;
+    UWORD i;
+
+    if (Ctx->Scale == 2 && Ctx->StepX == 1) {
+        uint32_t ForeBits = (Fore == BLACK)? 0: 0xFFFFFFFF;
+        uint32_t BackBits = (Back == BLACK)? 0: 0xFFFFFFFF;
+        UBYTE *Byte = &Ctx->Image[Index >> 3];
+        UBYTE Shift = Index & 7;
+        uint32_t Source, Mask, Value;
+        UWORD Count, Need;
+        int k;
+
+        // Up to 24 source bits at a time, they span at most 4 image bytes
+        for (i = 0; i < Width; i += 24) {
+            Count = (Width - i < 24)? Width - i: 24;
+            Need = Skip + Count;
+            Source = (uint32_t)Bits[0] << 24;
+            if (Need > 8)
+                Source |= (uint32_t)Bits[1] << 16;
+            if (Need > 16)
+                Source |= (uint32_t)Bits[2] << 8;
+            if (Need > 24)
+                Source |= Bits[3];
+            Source <<= Skip;
+            Bits += 3;
+
+            Mask = 0xFFFFFFFF << (32 - Count);
+            if (Transparent) {
+                Mask &= Source;
+                Value = ForeBits;
+            } else {
+                Value = (Source & ForeBits) | (~Source & BackBits);
+            }
+            Mask >>= Shift;
+            Value = (Value >> Shift) & Mask;
 
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+            for (k = 0; k < 4 && (Mask << (8 * k)); k++) {
+                UBYTE ByteMask = Mask >> (24 - 8 * k);
+                Byte[k] = (Byte[k] & ~ByteMask) | (UBYTE)(Value >> (24 - 8 * k));
+            }
+            Byte += 3;
         }
+        return;
+    }
+
+    for (i = Skip; i < Skip + Width; i++) {
+        if (Bits[i >> 3] & (0x80 >> (i & 7)))
+            Ctx->PutPixel(Ctx->Image, Index, Fore);
+        else if (!Transparent)
+            Ctx->PutPixel(Ctx->Image, Index, Back);
+        Index += Ctx->StepX;
     }
 }
+
+/******************************************************************************
+function: Clip the rows of a 1 bit per pixel bitmap to the clip rectangle
+parameter:
+    Xpoint, Ypoint : Top left pixel, moved inside the clip rectangle
+    Width, Height  : Size, cut to the clip rectangle
+    StrideBits     : Bits from one row to the next
+    Bit            : Set to the bit of the first visible pixel
+info:
+    Returns 0 when nothing is visible. Marks the visible area dirty
+******************************************************************************/
+static UBYTE Paint_ClipBits(PAINT *Ctx, UWORD *Xpoint, UWORD *Ypoint, UWORD *Width, UWORD *Height,
+                            UDOUBLE StrideBits, UDOUBLE *Bit)
+{
+    *Bit = 0;
+    if (*Width == 0 || *Height == 0 ||
+        *Xpoint >= Ctx->ClipXend || *Ypoint >= Ctx->ClipYend ||
+        *Xpoint + *Width <= Ctx->ClipXstart || *Ypoint + *Height <= Ctx->ClipYstart)
+        return 0;
+    if (*Xpoint < Ctx->ClipXstart) {
+        *Bit = Ctx->ClipXstart - *Xpoint;
+        *Width -= *Bit;
+        *Xpoint = Ctx->ClipXstart;
+    }
+    if (*Ypoint < Ctx->ClipYstart) {
+        *Bit += (Ctx->ClipYstart - *Ypoint) * StrideBits;
+        *Height -= Ctx->ClipYstart - *Ypoint;
+        *Ypoint = Ctx->ClipYstart;
+    }
+    if (*Width > Ctx->ClipXend - *Xpoint)
+        *Width = Ctx->ClipXend - *Xpoint;
+    if (*Height > Ctx->ClipYend - *Ypoint)
+        *Height = Ctx->ClipYend - *Ypoint;
+
+    Paint_MarkArea(Ctx, *Xpoint, *Ypoint, *Xpoint + *Width - 1, *Ypoint + *Height - 1);
+    return 1;
+}
+
+/******************************************************************************
+function: Draw 1 bit per pixel rows that start at any bit
+parameter:
+    Xpoint, Ypoint : Top left pixel
+    Bits           : The rows, MSB first, a set bit is foreground
+    Width          : Pixels per row
+    Height         : Number of rows
+    StrideBits     : Bits from one row to the next
+    Fore, Back     : Colors of the set and clear bits
+    Transparent    : Leave the clear bits as they are
+info:
+    Clipped to the clip rectangle, rows and columns at once
+******************************************************************************/
+static void Paint_BlitPacked(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const UBYTE *Bits, UWORD Width, UWORD Height,
+                             UDOUBLE StrideBits, UWORD Fore, UWORD Back, UBYTE Transparent)
+{
+    UDOUBLE Index, Bit;
+    UWORD Row;
+
+    if (!Paint_ClipBits(Ctx, &Xpoint, &Ypoint, &Width, &Height, StrideBits, &Bit))
+        return;
+
+    Index = Ctx->Origin + Xpoint * Ctx->StepX + Ypoint * Ctx->StepY;
+    for (Row = 0; Row < Height; Row++) {
+        Paint_BlitBits(Ctx, Index, Bits + (Bit >> 3), Bit & 7, Width, Fore, Back, Transparent);
+        Bit += StrideBits;
+        Index += Ctx->StepY;
+    }
+}
+
+/******************************************************************************
+function: Draw a 1 bit per pixel bitmap, such as a glyph
+parameter:
+    Xpoint           : X coordinate of the top left pixel
+    Ypoint           : Y coordinate of the top left pixel
+    Bits             : The rows, MSB first, a set bit is foreground
+    Width            : Pixels per row
+    Height           : Number of rows
+    Stride           : Bytes from one row to the next
+    Color_Foreground : Color of the set bits
+    Color_Background : Color of the clear bits
+    Transparent      : Leave the clear bits as they are
+info:
+    Clipped to the clip rectangle, rows and columns at once
+******************************************************************************/
+void PaintCtx_BlitBitmap(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const UBYTE *Bits, UWORD Width, UWORD Height, UWORD Stride,
+                         UWORD Color_Foreground, UWORD Color_Background, UBYTE Transparent)
+{
+    Paint_BlitPacked(Ctx, Xpoint, Ypoint, Bits, Width, Height, (UDOUBLE)Stride * 8,
+                     Color_Foreground, Color_Background, Transparent);
+}
+
+/******************************************************************************
+function: Show English characters
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void PaintCtx_DrawChar(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                       sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD RowBytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * RowBytes;
+    const unsigned char *ptr = &Font->table[Char_Offset];
+
+    //To determine whether the font background color and screen background color is consistent
+    UBYTE Transparent = (FONT_BACKGROUND == Color_Background);
+    PaintCtx_BlitBitmap(Ctx, Xpoint, Ypoint, ptr, Font->Width, Font->Height, RowBytes,
+                        Color_Foreground, Color_Background, Transparent);
+}
+
+/******************************************************************************
+function:	Display the string
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void PaintCtx_DrawString_EN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString,
+                            sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    while (* pString != '\0') {
+        //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
+        if ((Xpoint + Font->Width ) > Ctx->Width ) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+
+        // If the Y direction is full, reposition to(Xstart, Ystart)
+        if ((Ypoint  + Font->Height ) > Ctx->Height ) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        PaintCtx_DrawChar(Ctx, Xpoint, Ypoint, * pString, Font, Color_Foreground, Color_Background);
+
+        //The next character of the address
+        pString ++;
+
+        //The next word of the abscissa increases the font of the broadband
+        Xpoint += Font->Width;
+    }
+}
+
+
+// Paint_ScaleBits[Scale - 2][n]: the 4 bits of n, each repeated Scale times,
+// in the top 4 * Scale bits
+static const uint32_t Paint_ScaleBits[PAINT_TEXT_SCALE_MAX - 1][16] = {
+    {   // 2
+        0x00000000, 0x03000000, 0x0C000000, 0x0F000000,
+        0x30000000, 0x33000000, 0x3C000000, 0x3F000000,
+        0xC0000000, 0xC3000000, 0xCC000000, 0xCF000000,
+        0xF0000000, 0xF3000000, 0xFC000000, 0xFF000000,
+    },
+    {   // 3
+        0x00000000, 0x00700000, 0x03800000, 0x03F00000,
+        0x1C000000, 0x1C700000, 0x1F800000, 0x1FF00000,
+        0xE0000000, 0xE0700000, 0xE3800000, 0xE3F00000,
+        0xFC000000, 0xFC700000, 0xFF800000, 0xFFF00000,
+    },
+    {   // 4
+        0x00000000, 0x000F0000, 0x00F00000, 0x00FF0000,
+        0x0F000000, 0x0F0F0000, 0x0FF00000, 0x0FFF0000,
+        0xF0000000, 0xF00F0000, 0xF0F00000, 0xF0FF0000,
+        0xFF000000, 0xFF0F0000, 0xFFF00000, 0xFFFF0000,
+    },
+    {   // 5
+        0x00000000, 0x0001F000, 0x003E0000, 0x003FF000,
+        0x07C00000, 0x07C1F000, 0x07FE0000, 0x07FFF000,
+        0xF8000000, 0xF801F000, 0xF83E0000, 0xF83FF000,
+        0xFFC00000, 0xFFC1F000, 0xFFFE0000, 0xFFFFF000,
+    },
+    {   // 6
+        0x00000000, 0x00003F00, 0x000FC000, 0x000FFF00,
+        0x03F00000, 0x03F03F00, 0x03FFC000, 0x03FFFF00,
+        0xFC000000, 0xFC003F00, 0xFC0FC000, 0xFC0FFF00,
+        0xFFF00000, 0xFFF03F00, 0xFFFFC000, 0xFFFFFF00,
+    },
+    {   // 7
+        0x00000000, 0x000007F0, 0x0003F800, 0x0003FFF0,
+        0x01FC0000, 0x01FC07F0, 0x01FFF800, 0x01FFFFF0,
+        0xFE000000, 0xFE0007F0, 0xFE03F800, 0xFE03FFF0,
+        0xFFFC0000, 0xFFFC07F0, 0xFFFFF800, 0xFFFFFFF0,
+    },
+    {   // 8
+        0x00000000, 0x000000FF, 0x0000FF00, 0x0000FFFF,
+        0x00FF0000, 0x00FF00FF, 0x00FFFF00, 0x00FFFFFF,
+        0xFF000000, 0xFF0000FF, 0xFF00FF00, 0xFF00FFFF,
+        0xFFFF0000, 0xFFFF00FF, 0xFFFFFF00, 0xFFFFFFFF,
+    },
+};
+
+/******************************************************************************
+function: Repeat every bit of a row Scale times
+parameter:
+    Bits  : The row, MSB first
+    Width : Bits of the row
+    Scale : 2 .. PAINT_TEXT_SCALE_MAX
+    Out   : Gets Width * Scale bits, rounded up to 4 * Scale
+info:
+    A nibble at a time through Paint_ScaleBits
+******************************************************************************/
+static void Paint_ScaleRow(const UBYTE *Bits, UWORD Width, UBYTE Scale, UBYTE *Out)
+{
+    const uint32_t *Table = Paint_ScaleBits[Scale - 2];
+    uint64_t Pending = 0;       // Bits not yet in Out, from the top
+    UBYTE PendingBits = 0;
+    UWORD i;
+
+    for (i = 0; i < Width; i += 4) {
+        Pending |= (uint64_t)Table[(Bits[i >> 3] >> (4 - (i & 4))) & 0x0F] << (32 - PendingBits);
+        PendingBits += 4 * Scale;
+        while (PendingBits >= 8) {
+            *Out++ = Pending >> 56;
+            Pending <<= 8;
+            PendingBits -= 8;
+        }
+    }
+    if (PendingBits > 0)
+        *Out = Pending >> 56;
+}
+
+/******************************************************************************
+function: Show an English character, every pixel a Scale x Scale square
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Scale            ：1 .. PAINT_TEXT_SCALE_MAX
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Each glyph row is widened once and blitted as spans for as many image
+    rows as it covers, equal glyph rows together
+******************************************************************************/
+void PaintCtx_DrawChar_Scaled(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT* Font,
+                              UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD RowBytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    const UBYTE *Row = &Font->table[(Acsii_Char - ' ') * Font->Height * RowBytes];
+    UBYTE Transparent = (FONT_BACKGROUND == Color_Background);
+    UBYTE Wide[MAX_WIDTH_FONT * PAINT_TEXT_SCALE_MAX / 8];
+    UWORD Y, Rows;
+
+    if (Scale <= 1) {
+        PaintCtx_DrawChar(Ctx, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+        return;
+    }
+    if (Scale > PAINT_TEXT_SCALE_MAX || Font->Width > MAX_WIDTH_FONT) {
+        Debug("Paint_DrawChar_Scaled Input exceeds the scale range\r\n");
+        return;
+    }
+
+    for (Y = 0; Y < Font->Height; Y += Rows) {
+        for (Rows = 1; Y + Rows < Font->Height; Rows++)
+            if (memcmp(Row, Row + Rows * RowBytes, RowBytes) != 0)
+                break;
+        Paint_ScaleRow(Row, Font->Width, Scale, Wide);
+        Paint_BlitPacked(Ctx, Xpoint, Ypoint + Y * Scale, Wide, Font->Width * Scale, Rows * Scale, 0,
+                         Color_Foreground, Color_Background, Transparent);
+        Row += Rows * RowBytes;
+    }
+}
+
+/******************************************************************************
+function: Display a string, every pixel a Scale x Scale square
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Scale            ：1 .. PAINT_TEXT_SCALE_MAX
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Wraps like Paint_DrawString_EN
+******************************************************************************/
+void PaintCtx_DrawString_Scaled(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font,
+                                UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    UWORD Width = Font->Width * Scale;
+    UWORD Height = Font->Height * Scale;
+
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawString_Scaled Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    for (; *pString != '\0'; pString++) {
+        if ((Xpoint + Width) > Ctx->Width) {
+            Xpoint = Xstart;
+            Ypoint += Height;
+        }
+        if ((Ypoint + Height) > Ctx->Height) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        PaintCtx_DrawChar_Scaled(Ctx, Xpoint, Ypoint, *pString, Font, Scale, Color_Foreground, Color_Background);
+        Xpoint += Width;
+    }
+}
+
+/******************************************************************************
+function: The glyph of a character of a proportional or anti-aliased font,
+          NULL when the font does not have it
+******************************************************************************/
+static const pGLYPH* Paint_FindGlyph(const pGLYPH *Glyphs, UBYTE First, UBYTE Last, char Acsii_Char)
+{
+    UBYTE Code = (UBYTE)Acsii_Char;
+
+    if (Code < First || Code > Last)
+        return NULL;
+    return &Glyphs[Code - First];
+}
+
+/******************************************************************************
+function: Show a character of a proportional font
+parameter:
+    Xpoint           ：X coordinate of the top left of the character
+    Ypoint           ：Y coordinate of the top left of the character
+    Acsii_Char       ：To display the English characters
+    Font             ：A proportional font
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Only the box of the ink is blitted. A background other than
+    FONT_BACKGROUND first fills the advance by the line height. Returns the
+    advance, 0 for a character the font does not have
+******************************************************************************/
+UWORD PaintCtx_DrawChar_Prop(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                             pFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    const pGLYPH *Glyph = Paint_FindGlyph(Font->glyphs, Font->first, Font->last, Acsii_Char);
+
+    if (Glyph == NULL)
+        return 0;
+    if (FONT_BACKGROUND != Color_Background)
+        PaintCtx_FillRect(Ctx, Xpoint, Ypoint, Xpoint + Glyph->advance, Ypoint + Font->Height, Color_Background);
+    Paint_BlitPacked(Ctx, Xpoint, Ypoint + Glyph->top, &Font->bitmap[Glyph->offset], Glyph->width, Glyph->height,
+                     Glyph->width, Color_Foreground, Color_Background, 1);
+    return Glyph->advance;
+}
+
+/******************************************************************************
+function: Width of a string in a proportional font, the sum of the advances
+******************************************************************************/
+UWORD Paint_GetStringWidth_Prop(const char * pString, pFONT* Font)
+{
+    const pGLYPH *Glyph;
+    UWORD Width = 0;
+
+    for (; *pString != '\0'; pString++) {
+        Glyph = Paint_FindGlyph(Font->glyphs, Font->first, Font->last, *pString);
+        if (Glyph != NULL)
+            Width += Glyph->advance;
+    }
+    return Width;
+}
+
+/******************************************************************************
+function: Display a string in a proportional font
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A proportional font
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Wraps like Paint_DrawString_EN, at the advance of each character
+******************************************************************************/
+void PaintCtx_DrawString_Prop(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString,
+                              pFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    const pGLYPH *Glyph;
+
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawString_Prop Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    for (; *pString != '\0'; pString++) {
+        Glyph = Paint_FindGlyph(Font->glyphs, Font->first, Font->last, *pString);
+        if (Glyph == NULL)
+            continue;
+        if ((Xpoint + Glyph->advance) > Ctx->Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > Ctx->Height) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Xpoint += PaintCtx_DrawChar_Prop(Ctx, Xpoint, Ypoint, *pString, Font, Color_Foreground, Color_Background);
+    }
+}
+
+/******************************************************************************
+function: Show a character of an anti-aliased font
+parameter:
+    Xpoint           ：X coordinate of the top left of the character
+    Ypoint           ：Y coordinate of the top left of the character
+    Acsii_Char       ：To display the English characters
+    Font             ：An anti-aliased font
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    In 4 gray the coverage mixes the foreground into the background. Over a
+    background color the cell is filled first and the 4 levels come from a
+    table, over FONT_BACKGROUND the image is read where the ink is partial.
+    Other scales draw the pixels at least half covered. Returns the
+    advance, 0 for a character the font does not have
+******************************************************************************/
+UWORD PaintCtx_DrawChar_AA(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                           aFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    const pGLYPH *Glyph = Paint_FindGlyph(Font->glyphs, Font->first, Font->last, Acsii_Char);
+    UBYTE Transparent = (FONT_BACKGROUND == Color_Background);
+    UBYTE Gray = (Ctx->Scale == 4);
+    UWORD Fore = Color_Foreground % 4, Back;
+    UWORD Level[4];
+    UWORD Xbox, Ybox, X0, Y0, X1, Y1, X, Y;
+    UDOUBLE Index, Bit;
+    UBYTE Coverage;
+
+    if (Glyph == NULL)
+        return 0;
+    if (!Transparent)
+        PaintCtx_FillRect(Ctx, Xpoint, Ypoint, Xpoint + Glyph->advance, Ypoint + Font->Height, Color_Background);
+
+    for (Coverage = 0; Coverage < 4; Coverage++) {
+        if (Gray)
+            Level[Coverage] = (Fore * Coverage + (Color_Background % 4) * (3 - Coverage) + 1) / 3;
+        else
+            Level[Coverage] = (Coverage >= 2)? Color_Foreground: Color_Background;
+    }
+
+    Xbox = Xpoint;
+    Ybox = Ypoint + Glyph->top;
+    X0 = (Xbox > Ctx->ClipXstart)? Xbox: Ctx->ClipXstart;
+    Y0 = (Ybox > Ctx->ClipYstart)? Ybox: Ctx->ClipYstart;
+    X1 = (Xbox + Glyph->width < Ctx->ClipXend)? Xbox + Glyph->width: Ctx->ClipXend;
+    Y1 = (Ybox + Glyph->height < Ctx->ClipYend)? Ybox + Glyph->height: Ctx->ClipYend;
+    if (X0 >= X1 || Y0 >= Y1)
+        return Glyph->advance;
+    Paint_MarkArea(Ctx, X0, Y0, X1 - 1, Y1 - 1);
+
+    for (Y = Y0; Y < Y1; Y++) {
+        Bit = ((UDOUBLE)(Y - Ybox) * Glyph->width + (X0 - Xbox)) * 2;
+        Index = Ctx->Origin + X0 * Ctx->StepX + Y * Ctx->StepY;
+        for (X = X0; X < X1; X++, Bit += 2, Index += Ctx->StepX) {
+            Coverage = (Font->bitmap[Glyph->offset + (Bit >> 3)] >> (6 - (Bit & 7))) & 0x03;
+            if (Coverage == 0 || (Transparent && !Gray && Coverage < 2))
+                continue;
+            if (Transparent && Gray && Coverage < 3) {
+                Back = Ctx->FetchPixel(Ctx->Image, Index) >> 6;
+                Ctx->PutPixel(Ctx->Image, Index, (Fore * Coverage + Back * (3 - Coverage) + 1) / 3);
+            } else {
+                Ctx->PutPixel(Ctx->Image, Index, Level[Coverage]);
+            }
+        }
+    }
+    return Glyph->advance;
+}
+
+/******************************************************************************
+function: Width of a string in an anti-aliased font, the sum of the advances
+******************************************************************************/
+UWORD Paint_GetStringWidth_AA(const char * pString, aFONT* Font)
+{
+    const pGLYPH *Glyph;
+    UWORD Width = 0;
+
+    for (; *pString != '\0'; pString++) {
+        Glyph = Paint_FindGlyph(Font->glyphs, Font->first, Font->last, *pString);
+        if (Glyph != NULL)
+            Width += Glyph->advance;
+    }
+    return Width;
+}
+
+/******************************************************************************
+function: Display a string in an anti-aliased font
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：An anti-aliased font
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Wraps like Paint_DrawString_EN, at the advance of each character
+******************************************************************************/
+void PaintCtx_DrawString_AA(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString,
+                            aFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    const pGLYPH *Glyph;
+
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
+        Debug("Paint_DrawString_AA Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    for (; *pString != '\0'; pString++) {
+        Glyph = Paint_FindGlyph(Font->glyphs, Font->first, Font->last, *pString);
+        if (Glyph == NULL)
+            continue;
+        if ((Xpoint + Glyph->advance) > Ctx->Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > Ctx->Height) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Xpoint += PaintCtx_DrawChar_AA(Ctx, Xpoint, Ypoint, *pString, Font, Color_Foreground, Color_Background);
+    }
+}
+
+/******************************************************************************
+function: Find a glyph of a Chinese font
+parameter:
+    Codes : An index of the font, sorted by code
+    Count : Entries of the index
+    Code  : GB2312 code or Unicode code point
+info:
+    Binary search, returns the position of the glyph in the table of the
+    font, or -1 when the font has no such glyph. Of equal codes the first
+    entry wins, as the table scan it replaced did
+******************************************************************************/
+static int32_t Paint_FindGlyphCN(const CH_CN_CODE *Codes, UWORD Count, UDOUBLE Code)
+{
+    UDOUBLE Low = 0, High = Count, Middle;
+
+    while(Low < High) {
+        Middle = (Low + High) / 2;
+        if(Codes[Middle].code < Code)
+            Low = Middle + 1;
+        else
+            High = Middle;
+    }
+    if(Low < Count && Codes[Low].code == Code)
+        return Codes[Low].glyph;
+    return -1;
+}
+
+/******************************************************************************
+function: Is a string UTF-8
+info:
+    Returns 1 when the string is well formed UTF-8 and has a character
+    beyond ASCII. GB2312 text is hardly ever well formed UTF-8, ASCII
+    reads the same in both
+******************************************************************************/
+static UBYTE Paint_IsUTF8(const UBYTE *Text)
+{
+    UBYTE Multibyte = 0, Follow;
+
+    while(*Text != 0) {
+        if(*Text < 0x80)
+            Follow = 0;
+        else if((*Text & 0xE0) == 0xC0)
+            Follow = 1;
+        else if((*Text & 0xF0) == 0xE0)
+            Follow = 2;
+        else if((*Text & 0xF8) == 0xF0)
+            Follow = 3;
+        else
+            return 0;
+        for(Text++; Follow > 0; Follow--, Text++) {
+            if((*Text & 0xC0) != 0x80)
+                return 0;
+            Multibyte = 1;
+        }
+    }
+    return Multibyte;
+}
+
+/******************************************************************************
+function: Display the string
+parameter:
+    Xstart  ：X coordinate
+    Ystart  ：Y coordinate
+    pString ：The first address of the Chinese string and English
+              string to be displayed, GB2312 or UTF-8
+    Font    ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Glyphs are found by binary search of the GB2312 or Unicode index of
+    the font. A character the font does not have leaves its space empty
+******************************************************************************/
+void PaintCtx_DrawString_CN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    const UBYTE* p_text = (const UBYTE*)pString;
+    int x = Xstart, y = Ystart;
+    UWORD RowBytes = font->Width / 8 + (font->Width % 8 ? 1 : 0);
+    UBYTE Transparent = (FONT_BACKGROUND == Color_Background);
+    UBYTE UTF8 = Paint_IsUTF8(p_text);
+    const CH_CN_CODE *Codes = UTF8? font->unicode: font->gb2312;
+    UDOUBLE Code;
+    UWORD Advance;
+    UBYTE Follow;
+    int32_t Glyph;
+
+    /* Send the string character by character on EPD */
+    while (*p_text != 0) {
+        if(*p_text < 0x80) {  //ASCII
+            Code = *p_text;
+            p_text += 1;
+            Advance = font->ASCII_Width;
+        } else if(UTF8) {
+            Follow = (*p_text >= 0xF0)? 3: (*p_text >= 0xE0)? 2: 1;
+            Code = *p_text & (0x3F >> Follow);
+            for(p_text++; Follow > 0; Follow--, p_text++)
+                Code = (Code << 6) | (*p_text & 0x3F);
+            Advance = font->Width;
+        } else {        //Chinese
+            if(p_text[1] == 0)
+                break;
+            Code = (p_text[0] << 8) | p_text[1];
+            p_text += 2;
+            Advance = font->Width;
+        }
+
+        Glyph = Paint_FindGlyphCN(Codes, font->size, Code);
+        if(Glyph >= 0) {
+            const UBYTE* ptr = (const UBYTE*)&font->table[Glyph].matrix[0];
+            PaintCtx_BlitBitmap(Ctx, x, y, ptr, font->Width, font->Height, RowBytes,
+                                Color_Foreground, Color_Background, Transparent);
+        }
+        /* Point on the next character */
+        x += Advance;
+    }
+}
+
+/******************************************************************************
+function:	Display nummber
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    Nummber          : The number displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+#define  ARRAY_LEN 255
+void PaintCtx_DrawNum(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+                      sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+
+    int16_t Num_Bit = 0, Str_Bit = 0;
+    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
+    uint8_t *pStr = Str_Array;
+
+    if (Xpoint > Ctx->Width || Ypoint > Ctx->Height) {
+        Debug("Paint_DisNum Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    //Converts a number to a string
+    while (Nummber) {
+        Num_Array[Num_Bit] = Nummber % 10 + '0';
+        Num_Bit++;
+        Nummber /= 10;
+    }
+
+    //The string is inverted
+    while (Num_Bit > 0) {
+        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
+        Str_Bit ++;
+        Num_Bit --;
+    }
+
+    //show
+    PaintCtx_DrawString_EN(Ctx, Xpoint, Ypoint, (const char*)pStr, Font, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Display time
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    pTime            : Time-related structures
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void PaintCtx_DrawTime(PAINT *Ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+                       UWORD Color_Foreground, UWORD Color_Background)
+{
+    uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    UWORD Dx = Font->Width;
+
+    //Write data into the cache
+    PaintCtx_DrawChar(Ctx, Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(Ctx, Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+}
+
+/******************************************************************************
+function:	Display monochrome bitmap
+parameter:
+    image_buffer ：A picture data converted to a bitmap
+info:
+    Use a computer to convert the image into a corresponding array,
+    and then embed the array directly into Imagedata.cpp as a .c file.
+******************************************************************************/
+void PaintCtx_DrawBitMap(PAINT *Ctx, const unsigned char* image_buffer)
+{
+    memcpy(Ctx->Image, image_buffer, (UDOUBLE)Ctx->WidthByte * Ctx->HeightByte);
+    Paint_MarkMemory(Ctx, 0, 0, Ctx->RowPixels - 1, Ctx->HeightByte - 1);
+}
+
+// Image memory words hold their first pixel in the MSB whatever the byte order
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define PAINT_WORD_ORDER(Word)  (Word)
+#else
+#define PAINT_WORD_ORDER(Word)  __builtin_bswap32(Word)
+#endif
+
+/******************************************************************************
+function: Combine source bits with image bits
+parameter:
+    Rop    : Raster op
+    Dest   : Image bits
+    Source : Source bits, set is white
+******************************************************************************/
+static uint32_t Paint_Rop(BLIT_ROP Rop, uint32_t Dest, uint32_t Source)
+{
+    switch (Rop) {
+    case BLIT_OR:
+        return Dest | Source;
+    case BLIT_AND:
+        return Dest & Source;
+    case BLIT_XOR:
+        return Dest ^ Source;
+    case BLIT_NOT:
+        return ~Source;
+    default:
+        return Source;
+    }
+}
+
+/******************************************************************************
+function: Read 32 bits of a source row, the first one in the MSB
+parameter:
+    Bits : The row
+    Bit  : Bit of the row to start at
+    Last : Last byte of the row that may be read
+******************************************************************************/
+static uint32_t Paint_BlitSource(const UBYTE *Bits, UDOUBLE Bit, UDOUBLE Last)
+{
+    UDOUBLE Byte = Bit >> 3;
+    UBYTE Shift = Bit & 7;
+    uint32_t Source = 0;
+    int k;
+
+    for (k = 0; k < 4 && Byte + k <= Last; k++)
+        Source |= (uint32_t)Bits[Byte + k] << (24 - 8 * k);
+    Source <<= Shift;
+    if (Shift && Byte + 4 <= Last)
+        Source |= Bits[Byte + 4] >> (8 - Shift);
+    return Source;
+}
+
+/******************************************************************************
+function: Combine a row of source bits into the image memory
+parameter:
+    Index : Pixel index of the first pixel, see Paint_SetAddressing
+    Bits  : The row, MSB first
+    Skip  : Bits of Bits[0] before the first pixel, 0 .. 7
+    Width : Number of pixels, already clipped
+    Rop   : Raster op
+info:
+    When the row runs left to right through the memory of a black and
+    white image, the image is combined a byte at a time up to a word
+    boundary, then 32 bits at a time with aligned words, then the bytes
+    left. Otherwise each pixel is read, combined and written, with a set
+    source bit as all bits of the pixel set
+******************************************************************************/
+static void Paint_BlitRop(PAINT *Ctx, UDOUBLE Index, const UBYTE *Bits, UBYTE Skip, UWORD Width, BLIT_ROP Rop)
+{
+    UDOUBLE Last = (Skip + Width - 1) >> 3;
+    UWORD i;
+
+    if (Ctx->Scale == 2 && Ctx->StepX == 1) {
+        UBYTE *Byte = &Ctx->Image[Index >> 3];
+        int Pixel = -(int)(Index & 7);     // Pixel at the MSB of *Byte
+        uint32_t Word;
+        UBYTE Source, Mask;
+
+        while (Pixel < Width) {
+            if (Pixel >= 0 && ((uintptr_t)Byte & 3) == 0) {
+                // Whole words
+                for (; Pixel + 32 <= Width; Pixel += 32, Byte += 4) {
+                    memcpy(&Word, __builtin_assume_aligned(Byte, 4), 4);
+                    Word = PAINT_WORD_ORDER(Paint_Rop(Rop, PAINT_WORD_ORDER(Word),
+                                                      Paint_BlitSource(Bits, Skip + Pixel, Last)));
+                    memcpy(__builtin_assume_aligned(Byte, 4), &Word, 4);
+                }
+                if (Pixel >= Width)
+                    break;
+            }
+            Mask = 0xFF;
+            if (Pixel < 0) {
+                Mask >>= -Pixel;
+                Source = (Paint_BlitSource(Bits, Skip, Last) >> 24) >> -Pixel;
+            } else {
+                Source = Paint_BlitSource(Bits, Skip + Pixel, Last) >> 24;
+            }
+            if (Pixel + 8 > Width)
+                Mask &= 0xFF << (Pixel + 8 - Width);
+            *Byte = (*Byte & ~Mask) | (Paint_Rop(Rop, *Byte, Source) & Mask);
+            Byte++;
+            Pixel += 8;
+        }
+        return;
+    }
+
+    {
+        UBYTE Shift = 8 - 8 / Ctx->Format->PixelsPerByte;
+        UBYTE First = 0xFF << Shift;
+        UBYTE Source;
+
+        for (i = Skip; i < Skip + Width; i++) {
+            Source = (Bits[i >> 3] & (0x80 >> (i & 7)))? 0xFF: 0;
+            Ctx->PutPixel(Ctx->Image, Index,
+                           (Paint_Rop(Rop, Ctx->FetchPixel(Ctx->Image, Index), Source) & First) >> Shift);
+            Index += Ctx->StepX;
+        }
+    }
+}
+
+/******************************************************************************
+function: Combine a 1 bit per pixel image into the paint image
+parameter:
+    Source       : The image, rows of (SourceWidth + 7) / 8 bytes, MSB first,
+                   a set bit is white as in the image memory
+    SourceWidth  : Pixels per row
+    SourceHeight : Number of rows
+    Xpoint       : X coordinate of the top left pixel, any pixel
+    Ypoint       : Y coordinate of the top left pixel
+    Rop          : How the source combines with the image
+info:
+    Clipped to the clip rectangle. Icons and sprites, and images drawn
+    into each other: OR keeps the white of both, AND the black of both,
+    XOR inverts where the source is white, NOT copies the source inverted
+******************************************************************************/
+void PaintCtx_Blit(PAINT *Ctx, const UBYTE *Source, UWORD SourceWidth, UWORD SourceHeight, UWORD Xpoint, UWORD Ypoint, BLIT_ROP Rop)
+{
+    UDOUBLE StrideBits = (UDOUBLE)((SourceWidth + 7) / 8) * 8;
+    UDOUBLE Index, Bit;
+    UWORD Width = SourceWidth, Height = SourceHeight, Row;
+
+    if (!Paint_ClipBits(Ctx, &Xpoint, &Ypoint, &Width, &Height, StrideBits, &Bit))
+        return;
+
+    Index = Ctx->Origin + Xpoint * Ctx->StepX + Ypoint * Ctx->StepY;
+    for (Row = 0; Row < Height; Row++) {
+        Paint_BlitRop(Ctx, Index, Source + (Bit >> 3), Bit & 7, Width, Rop);
+        Bit += StrideBits;
+        Index += Ctx->StepY;
+    }
+}
+
+/******************************************************************************
+function: Compose layers into the paint image
+parameter:
+    Layers : The layers and how each combines with what is below it
+    Count  : Number of layers
+info:
+    Every layer has the memory size and scale of the image. The first layer
+    combines with the image, so BLIT_COPY replaces it. The memory is read
+    a word at a time whatever the rotation and the clip, and each word is
+    combined through all layers before it is compared with the image.
+    Only the words that end up different are marked dirty, so composing a
+    background with a new overlay refreshes just what the overlay changed
+******************************************************************************/
+void PaintCtx_Compose(PAINT *Ctx, const PAINT_LAYER *Layers, UBYTE Count)
+{
+    UDOUBLE RowBytes = Ctx->WidthByte;
+    UDOUBLE Offset, X;
+    UWORD Xfirst = 0xFFFF, Xlast = 0, Yfirst = 0xFFFF, Ylast = 0;
+    UWORD Y;
+    UBYTE Aligned = ((uintptr_t)Ctx->Image & 3) == 0 && RowBytes % 4 == 0;
+    UBYTE Bytes = 1, i;
+    uint32_t Word, Old, Source;
+
+    for (i = 0; i < Count; i++) {
+        if (Layers[i].Image->WidthByte != RowBytes || Layers[i].Image->HeightMemory != Ctx->HeightMemory ||
+            Layers[i].Image->Scale != Ctx->Scale) {
+            Debug("Paint_Compose A layer differs from the image\r\n");
+            return;
+        }
+        if (((uintptr_t)Layers[i].Image->Image & 3) != 0)
+            Aligned = 0;
+    }
+
+    for (Y = 0; Y < Ctx->HeightMemory; Y++) {
+        for (X = 0; X < RowBytes; X += Bytes) {
+            Offset = Y * RowBytes + X;
+            if (Aligned) {
+                Bytes = 4;
+                memcpy(&Old, __builtin_assume_aligned(Ctx->Image + Offset, 4), 4);
+                Word = Old;
+                for (i = 0; i < Count; i++) {
+                    memcpy(&Source, __builtin_assume_aligned(Layers[i].Image->Image + Offset, 4), 4);
+                    Word = Paint_Rop(Layers[i].Rop, Word, Source);
+                }
+                if (Word == Old)
+                    continue;
+                memcpy(__builtin_assume_aligned(Ctx->Image + Offset, 4), &Word, 4);
+            } else {
+                Old = Ctx->Image[Offset];
+                Word = Old;
+                for (i = 0; i < Count; i++)
+                    Word = Paint_Rop(Layers[i].Rop, Word, Layers[i].Image->Image[Offset]) & 0xFF;
+                if (Word == Old)
+                    continue;
+                Ctx->Image[Offset] = Word;
+            }
+            if (X < Xfirst)
+                Xfirst = X;
+            if (X + Bytes - 1 > Xlast)
+                Xlast = X + Bytes - 1;
+            if (Yfirst == 0xFFFF)
+                Yfirst = Y;
+            Ylast = Y;
+        }
+    }
+
+    if (Yfirst <= Ylast) {
+        X = (UDOUBLE)(Xlast + 1) * Ctx->Format->PixelsPerByte;
+        Paint_MarkMemory(Ctx, Xfirst * Ctx->Format->PixelsPerByte, Yfirst,
+                         ((X < Ctx->WidthMemory)? X: Ctx->WidthMemory) - 1, Ylast);
+    }
+}
+
+/******************************************************************************
+function: Transpose an 8 x 8 block of bits
+parameter:
+    In        : First row of the block, MSB is the left pixel
+    InStride  : Bytes from one row of In to the next, negative reads it bottom up
+    Out       : First row of the transposed block
+    OutStride : Bytes from one row of Out to the next
+info:
+    Row i of Out is column i of In. The rows are packed into two words
+    and bits are swapped across the diagonal in 1, 2 and then 4 bit
+    squares, so the block takes a few dozen word operations instead of 64
+    pixel reads and writes
+******************************************************************************/
+static void Paint_Transpose8(const UBYTE *In, int32_t InStride, UBYTE *Out, int32_t OutStride)
+{
+    uint32_t Top, Bottom, t;
+
+    Top = (uint32_t)In[0] << 24 | (uint32_t)In[InStride] << 16 |
+          (uint32_t)In[2 * InStride] << 8 | In[3 * InStride];
+    Bottom = (uint32_t)In[4 * InStride] << 24 | (uint32_t)In[5 * InStride] << 16 |
+             (uint32_t)In[6 * InStride] << 8 | In[7 * InStride];
+
+    t = (Top ^ (Top >> 7)) & 0x00AA00AA;
+    Top ^= t ^ (t << 7);
+    t = (Bottom ^ (Bottom >> 7)) & 0x00AA00AA;
+    Bottom ^= t ^ (t << 7);
+    t = (Top ^ (Top >> 14)) & 0x0000CCCC;
+    Top ^= t ^ (t << 14);
+    t = (Bottom ^ (Bottom >> 14)) & 0x0000CCCC;
+    Bottom ^= t ^ (t << 14);
+    t = (Top & 0xF0F0F0F0) | ((Bottom >> 4) & 0x0F0F0F0F);
+    Bottom = ((Top << 4) & 0xF0F0F0F0) | (Bottom & 0x0F0F0F0F);
+    Top = t;
+
+    Out[0] = Top >> 24;
+    Out[OutStride] = Top >> 16;
+    Out[2 * OutStride] = Top >> 8;
+    Out[3 * OutStride] = Top;
+    Out[4 * OutStride] = Bottom >> 24;
+    Out[5 * OutStride] = Bottom >> 16;
+    Out[6 * OutStride] = Bottom >> 8;
+    Out[7 * OutStride] = Bottom;
+}
+
+// The bits of a byte in reverse order
+static UBYTE Paint_ReverseBits(UBYTE Byte)
+{
+    Byte = (Byte >> 4) | (Byte << 4);
+    Byte = ((Byte >> 2) & 0x33) | ((Byte & 0x33) << 2);
+    return ((Byte >> 1) & 0x55) | ((Byte & 0x55) << 1);
+}
+
+/******************************************************************************
+function: Rotate a 1 bit per pixel image into another buffer
+parameter:
+    Source : The image, rows of (Width + 7) / 8 bytes, MSB first
+    Width  : Pixels per row of Source
+    Height : Rows of Source
+    Dest   : The rotated image, must not overlap Source. Height x Width
+             for ROTATE_90 and ROTATE_270, Width x Height otherwise
+    Rotate : ROTATE_0, ROTATE_90, ROTATE_180 or ROTATE_270
+info:
+    Pixel (X, Y) of Source lands where Paint_SetRotate(Rotate) would draw
+    it, so a portrait image drawn with ROTATE_0 in its own orientation
+    becomes the memory layout of the panel in one pass, and the drawing
+    does not pay the rotation per pixel. When Width and Height are
+    multiples of 8 the quarter turns move 8 x 8 blocks through
+    Paint_Transpose8 and the half turn reverses bytes, otherwise every
+    pixel is moved on its own
+******************************************************************************/
+void Paint_RotateImage(const UBYTE *Source, UWORD Width, UWORD Height, UBYTE *Dest, UWORD Rotate)
+{
+    UWORD SourceBytes = (Width + 7) / 8;
+    UWORD DestBytes = (Rotate == ROTATE_90 || Rotate == ROTATE_270)? (Height + 7) / 8: SourceBytes;
+    UWORD X, Y, Xdest, Ydest;
+    const UBYTE *In;
+
+    if (Rotate != ROTATE_0 && Rotate != ROTATE_90 && Rotate != ROTATE_180 && Rotate != ROTATE_270) {
+        Debug("Paint_RotateImage Input parameter error\r\n");
+        return;
+    }
+    if (Rotate == ROTATE_0) {
+        memcpy(Dest, Source, (UDOUBLE)SourceBytes * Height);
+        return;
+    }
+
+    if (Width % 8 == 0 && Height % 8 == 0) {
+        for (Y = 0; Y < Height; Y += 8) {
+            for (X = 0; X < SourceBytes; X++) {
+                In = Source + (UDOUBLE)Y * SourceBytes + X;
+                if (Rotate == ROTATE_90) {
+                    // Source rows bottom up become the columns left to right
+                    Paint_Transpose8(In + 7 * SourceBytes, -(int32_t)SourceBytes,
+                                     Dest + (UDOUBLE)X * 8 * DestBytes + DestBytes - 1 - Y / 8, DestBytes);
+                } else if (Rotate == ROTATE_270) {
+                    // Source columns left to right become the rows bottom up
+                    Paint_Transpose8(In, SourceBytes,
+                                     Dest + (UDOUBLE)(Width - 1 - X * 8) * DestBytes + Y / 8, -(int32_t)DestBytes);
+                } else {
+                    for (Ydest = 0; Ydest < 8; Ydest++)
+                        Dest[(UDOUBLE)(Height - 1 - Y - Ydest) * DestBytes + SourceBytes - 1 - X] =
+                            Paint_ReverseBits(In[(UDOUBLE)Ydest * SourceBytes]);
+                }
+            }
+        }
+        return;
+    }
+
+    memset(Dest, 0, (UDOUBLE)DestBytes * ((Rotate == ROTATE_180)? Height: Width));
+    for (Y = 0; Y < Height; Y++) {
+        for (X = 0; X < Width; X++) {
+            if (!(Source[(UDOUBLE)Y * SourceBytes + X / 8] & (0x80 >> (X % 8))))
+                continue;
+            if (Rotate == ROTATE_90) {
+                Xdest = Height - 1 - Y;
+                Ydest = X;
+            } else if (Rotate == ROTATE_180) {
+                Xdest = Width - 1 - X;
+                Ydest = Height - 1 - Y;
+            } else {
+                Xdest = Y;
+                Ydest = Width - 1 - X;
+            }
+            Dest[(UDOUBLE)Ydest * DestBytes + Xdest / 8] |= 0x80 >> (Xdest % 8);
+        }
+    }
+}
+
+/******************************************************************************
+function: The Paint_ functions draw in the global Paint
+info:
+    Each one is the PaintCtx_ function of the same name with Ctx = &Paint,
+    Paint_NewImage or Paint_SelectImage picks the image they draw in
+******************************************************************************/
+void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    PaintCtx_NewImage(&Paint, image, Width, Height, Rotate, Color);
+}
+
+void Paint_SelectImage(UBYTE *image, UWORD Width, UWORD Height)
+{
+    PaintCtx_SelectImage(&Paint, image, Width, Height);
+}
+
+void Paint_SetRotate(UWORD Rotate)
+{
+    PaintCtx_SetRotate(&Paint, Rotate);
+}
+
+void Paint_SetMirroring(UBYTE mirror)
+{
+    PaintCtx_SetMirroring(&Paint, mirror);
+}
+
+void Paint_SetScale(UBYTE scale)
+{
+    PaintCtx_SetScale(&Paint, scale);
+}
+
+void Paint_PushClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PaintCtx_PushClip(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_PopClip(void)
+{
+    PaintCtx_PopClip(&Paint);
+}
+
+UBYTE Paint_GetDirty(PAINT_RECT *Rect)
+{
+    return PaintCtx_GetDirty(&Paint, Rect);
+}
+
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PaintCtx_MarkDirty(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_ResetDirty(void)
+{
+    PaintCtx_ResetDirty(&Paint);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    PaintCtx_SetPixel(&Paint, Xpoint, Ypoint, Color);
+}
+
+UWORD Paint_GetPixel(UWORD Xpoint, UWORD Ypoint)
+{
+    return PaintCtx_GetPixel(&Paint, Xpoint, Ypoint);
+}
+
+void Paint_Clear(UWORD Color)
+{
+    PaintCtx_Clear(&Paint, Color);
+}
+
+void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    PaintCtx_ClearWindows(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_FillRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    PaintCtx_FillRect(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    PaintCtx_DrawPoint(&Paint, Xpoint, Ypoint, Color, Dot_Pixel, Dot_Style);
+}
+
+void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    PaintCtx_DrawLine(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Line_Style);
+}
+
+void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawRectangle(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawCircle(&Paint, X_Center, Y_Center, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawEllipse(UWORD X_Center, UWORD Y_Center, UWORD X_Radius, UWORD Y_Radius,
+                       UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawEllipse(&Paint, X_Center, Y_Center, X_Radius, Y_Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawArc(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Start_Angle, UWORD End_Angle,
+                   UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawArc(&Paint, X_Center, Y_Center, Radius, Start_Angle, End_Angle, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawRoundedRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius,
+                                UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawRoundedRectangle(&Paint, Xstart, Ystart, Xend, Yend, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawPolyline(const PAINT_POINT *Points, UWORD Count,
+                        UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    PaintCtx_DrawPolyline(&Paint, Points, Count, Color, Line_width, Line_Style);
+}
+
+void Paint_FillPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    PaintCtx_FillPolygon(&Paint, Points, Count, Color, Fill_Rule);
+}
+
+void Paint_DrawPolygon(const PAINT_POINT *Points, UWORD Count,
+                       UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawPolygon(&Paint, Points, Count, Color, Line_width, Draw_Fill);
+}
+
+void Paint_BlitBitmap(UWORD Xpoint, UWORD Ypoint, const UBYTE *Bits, UWORD Width, UWORD Height, UWORD Stride,
+                      UWORD Color_Foreground, UWORD Color_Background, UBYTE Transparent)
+{
+    PaintCtx_BlitBitmap(&Paint, Xpoint, Ypoint, Bits, Width, Height, Stride, Color_Foreground, Color_Background, Transparent);
+}
+
+void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawChar(&Paint, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
+                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_EN(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawChar_Scaled(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT* Font,
+                           UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawChar_Scaled(&Paint, Xpoint, Ypoint, Acsii_Char, Font, Scale, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_Scaled(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font,
+                             UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_Scaled(&Paint, Xstart, Ystart, pString, Font, Scale, Color_Foreground, Color_Background);
+}
+
+UWORD Paint_DrawChar_Prop(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                          pFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    return PaintCtx_DrawChar_Prop(&Paint, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_Prop(UWORD Xstart, UWORD Ystart, const char * pString,
+                           pFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_Prop(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+UWORD Paint_DrawChar_AA(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                        aFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    return PaintCtx_DrawChar_AA(&Paint, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_AA(UWORD Xstart, UWORD Ystart, const char * pString,
+                         aFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_AA(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_CN(&Paint, Xstart, Ystart, pString, font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawNum(&Paint, Xpoint, Ypoint, Nummber, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawTime(&Paint, Xstart, Ystart, pTime, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawBitMap(const unsigned char* image_buffer)
+{
+    PaintCtx_DrawBitMap(&Paint, image_buffer);
+}
+
+void Paint_Blit(const UBYTE *Source, UWORD SourceWidth, UWORD SourceHeight, UWORD Xpoint, UWORD Ypoint, BLIT_ROP Rop)
+{
+    PaintCtx_Blit(&Paint, Source, SourceWidth, SourceHeight, Xpoint, Ypoint, Rop);
+}
+
+void Paint_Compose(const PAINT_LAYER *Layers, UBYTE Count)
+{
+    PaintCtx_Compose(&Paint, Layers, Count);
+}
@@ -72,9 +72,12 @@
 
 #include "DEV_Config.h"
 #include "../Fonts/fonts.h"
+#include "GUI_Canvas.h"
+
+#define PAINT_CLIP_DEPTH    8   // Paint_PushClip nesting
 
 /**
- * Image attributes
+ * Image attributes, the context that the PaintCtx_ functions draw in
 **/
 typedef struct {
     UBYTE *Image;
@@ -88,9 +91,34 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    // Pixel addressing for the rotation, mirroring and scale, see Paint_SetAddressing
+    UWORD XLimit;
+    UWORD YLimit;
+    int32_t Origin;
+    int32_t StepX;
+    int32_t StepY;
+    UDOUBLE RowPixels;
+    const CANVAS_FORMAT *Format;
+    void (*PutPixel)(UBYTE *Image, UDOUBLE Index, UWORD Color);
+    UWORD (*FetchPixel)(const UBYTE *Image, UDOUBLE Index);
+    // Drawing stays inside Clip*start .. Clip*end - 1, see Paint_PushClip
+    UWORD ClipXstart;
+    UWORD ClipYstart;
+    UWORD ClipXend;
+    UWORD ClipYend;
+    // The clips that Paint_PushClip replaced: Xstart, Ystart, Xend, Yend
+    UWORD ClipStack[PAINT_CLIP_DEPTH][4];
+    UBYTE ClipDepth;
+    // Memory pixels written since Paint_ResetDirty, Dirty*end not included, see Paint_GetDirty
+    UWORD DirtyXstart;
+    UWORD DirtyYstart;
+    UWORD DirtyXend;
+    UWORD DirtyYend;
 } PAINT;
 extern PAINT Paint;
 
+#define PAINT_TEXT_SCALE_MAX 8  // Paint_DrawChar_Scaled
+
 /**
  * Display rotate
 **/
@@ -172,6 +200,52 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * Which parts of a polygon whose edges cross are inside
+**/
+typedef enum {
+    FILL_RULE_EVEN_ODD = 0,
+    FILL_RULE_NONZERO,
+} FILL_RULE;
+
+/**
+ * How Paint_Blit combines the source with the image, bit by bit
+**/
+typedef enum {
+    BLIT_COPY = 0,      // Source
+    BLIT_OR,            // Image | source
+    BLIT_AND,           // Image & source
+    BLIT_XOR,           // Image ^ source
+    BLIT_NOT,           // ~Source
+} BLIT_ROP;
+
+/**
+ * A layer of Paint_Compose
+**/
+typedef struct {
+    const PAINT *Image;     // Same memory size and scale as the image composed into
+    BLIT_ROP Rop;           // How it combines with the layers below
+} PAINT_LAYER;
+
+/**
+ * A vertex of a polyline or polygon
+**/
+typedef struct {
+    UWORD X;
+    UWORD Y;
+} PAINT_POINT;
+#define PAINT_POLYGON_EDGES 128     // Most vertices of Paint_FillPolygon
+
+/**
+ * A rectangle of the image memory, as the panel sees it
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;     // Not included
+    UWORD Yend;     // Not included
+} PAINT_RECT;
+
 /**
  * Custom structure of a time attribute
 **/
@@ -196,24 +270,106 @@ void Paint_SetScale(UBYTE scale);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Paint_FillRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Paint_PushClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_PopClip(void);
+
+//Changed region
+UBYTE Paint_GetDirty(PAINT_RECT *Rect);
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_ResetDirty(void);
 
 //Drawing
 void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
 void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawEllipse(UWORD X_Center, UWORD Y_Center, UWORD X_Radius, UWORD Y_Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawArc(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Start_Angle, UWORD End_Angle, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawRoundedRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawPolyline(const PAINT_POINT *Points, UWORD Count, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void Paint_DrawPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_FillPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
 
 //Display string
+void Paint_BlitBitmap(UWORD Xpoint, UWORD Ypoint, const UBYTE *Bits, UWORD Width, UWORD Height, UWORD Stride, UWORD Color_Foreground, UWORD Color_Background, UBYTE Transparent);
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawChar_Scaled(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT* Font, UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_Scaled(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_DrawChar_Prop(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, pFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_Prop(UWORD Xstart, UWORD Ystart, const char * pString, pFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_GetStringWidth_Prop(const char * pString, pFONT* Font);
+UWORD Paint_DrawChar_AA(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, aFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_AA(UWORD Xstart, UWORD Ystart, const char * pString, aFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_GetStringWidth_AA(const char * pString, aFONT* Font);
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 
 //pic
 void Paint_DrawBitMap(const unsigned char* image_buffer);
+void Paint_Blit(const UBYTE *Source, UWORD SourceWidth, UWORD SourceHeight, UWORD Xpoint, UWORD Ypoint, BLIT_ROP Rop);
+void Paint_Compose(const PAINT_LAYER *Layers, UBYTE Count);
+void Paint_RotateImage(const UBYTE *Source, UWORD Width, UWORD Height, UBYTE *Dest, UWORD Rotate);
 
 
+/**
+ * The same functions on an explicit context. A context is set up with
+ * PaintCtx_NewImage and then drawn in with no global state, so images of
+ * any size and scale can be kept off screen and drawn on another core
+**/
+//init and Clear
+void PaintCtx_NewImage(PAINT *Ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void PaintCtx_SelectImage(PAINT *Ctx, UBYTE *image, UWORD Width, UWORD Height);
+void PaintCtx_SetRotate(PAINT *Ctx, UWORD Rotate);
+void PaintCtx_SetMirroring(PAINT *Ctx, UBYTE mirror);
+void PaintCtx_SetPixel(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+UWORD PaintCtx_GetPixel(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint);
+void PaintCtx_SetScale(PAINT *Ctx, UBYTE scale);
+
+void PaintCtx_Clear(PAINT *Ctx, UWORD Color);
+void PaintCtx_ClearWindows(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void PaintCtx_FillRect(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void PaintCtx_PushClip(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void PaintCtx_PopClip(PAINT *Ctx);
+
+//Changed region
+UBYTE PaintCtx_GetDirty(PAINT *Ctx, PAINT_RECT *Rect);
+void PaintCtx_MarkDirty(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void PaintCtx_ResetDirty(PAINT *Ctx);
+
+//Drawing
+void PaintCtx_DrawPoint(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
+void PaintCtx_DrawLine(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void PaintCtx_DrawRectangle(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawCircle(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawEllipse(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD X_Radius, UWORD Y_Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawArc(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Start_Angle, UWORD End_Angle, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawRoundedRectangle(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawPolyline(PAINT *Ctx, const PAINT_POINT *Points, UWORD Count, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void PaintCtx_DrawPolygon(PAINT *Ctx, const PAINT_POINT *Points, UWORD Count, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_FillPolygon(PAINT *Ctx, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
+
+//Display string
+void PaintCtx_BlitBitmap(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const UBYTE *Bits, UWORD Width, UWORD Height, UWORD Stride, UWORD Color_Foreground, UWORD Color_Background, UBYTE Transparent);
+void PaintCtx_DrawChar(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_EN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawChar_Scaled(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT* Font, UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_Scaled(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UBYTE Scale, UWORD Color_Foreground, UWORD Color_Background);
+UWORD PaintCtx_DrawChar_Prop(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, pFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_Prop(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, pFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD PaintCtx_DrawChar_AA(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, aFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_AA(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, aFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_CN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawNum(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawTime(PAINT *Ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+
+//pic
+void PaintCtx_DrawBitMap(PAINT *Ctx, const unsigned char* image_buffer);
+void PaintCtx_Blit(PAINT *Ctx, const UBYTE *Source, UWORD SourceWidth, UWORD SourceHeight, UWORD Xpoint, UWORD Ypoint, BLIT_ROP Rop);
+void PaintCtx_Compose(PAINT *Ctx, const PAINT_LAYER *Layers, UBYTE Count);
+
 #endif
 
 
@@ -79,6 +79,63 @@ static void EPD_SendData2(UBYTE *pData, UDOUBLE len)
     DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
+/******************************************************************************
+function :	send a command that returns data
+parameter:
+     Reg : Command register
+info:
+    The data line is bidirectional, so reads are bit-banged.
+    Follow with EPD_ReadData
+******************************************************************************/
+static void EPD_SendReadCommand(UBYTE Reg)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 0);
+    DEV_SPI_SendData(Reg);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+}
+
+/******************************************************************************
+function :	read data
+parameter:
+    pData : Receives the data
+    Len   : Number of bytes to read
+info:
+    Hands the pins back to the SPI block afterwards
+******************************************************************************/
+static void EPD_ReadData(UBYTE *pData, UBYTE Len)
+{
+    UBYTE i;
+    for(i = 0; i < Len; i++) {
+        pData[i] = DEV_SPI_ReadData();
+    }
+    DEV_SPI_Init();
+}
+
+/******************************************************************************
+function :	4 gray conversion tables
+info:
+    A 2bpp image byte holds 4 pixels (white 0xC0, gray1 0x80, gray2 0x40,
+    black 0x00). Each table maps one image byte to the 4 bits it contributes
+    to a RAM plane, so two image bytes give one plane byte.
+    Old data (0x10) is set for black and gray1,
+    new data (0x13) is set for black and gray2.
+******************************************************************************/
+#define GRAY4_OLD_BIT(b, s)     ((((b) >> (s)) & 0x01) ? 0 : 1)
+#define GRAY4_NEW_BIT(b, s)     ((((b) >> (s)) & 0x02) ? 0 : 1)
+#define GRAY4_OLD(b)    ((GRAY4_OLD_BIT(b, 6) << 3) | (GRAY4_OLD_BIT(b, 4) << 2) | \
+                         (GRAY4_OLD_BIT(b, 2) << 1) | GRAY4_OLD_BIT(b, 0))
+#define GRAY4_NEW(b)    ((GRAY4_NEW_BIT(b, 6) << 3) | (GRAY4_NEW_BIT(b, 4) << 2) | \
+                         (GRAY4_NEW_BIT(b, 2) << 1) | GRAY4_NEW_BIT(b, 0))
+#define GRAY4_ROW(f, b) f(b + 0), f(b + 1), f(b + 2), f(b + 3), f(b + 4), f(b + 5), f(b + 6), f(b + 7), \
+                        f(b + 8), f(b + 9), f(b + 10), f(b + 11), f(b + 12), f(b + 13), f(b + 14), f(b + 15)
+#define GRAY4_TABLE(f)  GRAY4_ROW(f, 0x00), GRAY4_ROW(f, 0x10), GRAY4_ROW(f, 0x20), GRAY4_ROW(f, 0x30), \
+                        GRAY4_ROW(f, 0x40), GRAY4_ROW(f, 0x50), GRAY4_ROW(f, 0x60), GRAY4_ROW(f, 0x70), \
+                        GRAY4_ROW(f, 0x80), GRAY4_ROW(f, 0x90), GRAY4_ROW(f, 0xA0), GRAY4_ROW(f, 0xB0), \
+                        GRAY4_ROW(f, 0xC0), GRAY4_ROW(f, 0xD0), GRAY4_ROW(f, 0xE0), GRAY4_ROW(f, 0xF0)
+
+static const UBYTE EPD_4Gray_LUT_Old[256] = { GRAY4_TABLE(GRAY4_OLD) };
+static const UBYTE EPD_4Gray_LUT_New[256] = { GRAY4_TABLE(GRAY4_NEW) };
+
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -103,6 +160,137 @@ static void EPD_7IN5_V2_TurnOnDisplay(void)
     EPD_WaitUntilIdle();
 }
 
+/******************************************************************************
+function :	Wait until the busy_pin of every panel in the mask goes HIGH
+parameter:
+    PanelMask : Bit n set waits for panel n
+info:
+    Used after EPD_7IN5_V2_Display_Start so panels refresh at the same time
+******************************************************************************/
+void EPD_7IN5_V2_WaitUntilIdle_All(UBYTE PanelMask)
+{
+    UBYTE i, Busy;
+
+    Debug("e-Paper busy\r\n");
+    DEV_Delay_ms(100);	        //!!!The delay here is necessary, 200uS at least!!!
+    do{
+        DEV_Delay_ms(5);
+        Busy = 0;
+        for(i = 0; i < EPD_Panel_Count; i++) {
+            if((PanelMask & (1 << i)) && !DEV_Digital_Read(EPD_Panels[i].BUSY_PIN)) {
+                Busy = 1;
+            }
+        }
+    }while(Busy);
+    DEV_Delay_ms(5);
+    Debug("e-Paper busy release\r\n");
+}
+
+/******************************************************************************
+function :	Read the controller status (FLG)
+parameter:
+info:
+    bit0 BUSY_N, bit1 POF, bit2 PON, bit3 data flag, bit6 partial mode
+******************************************************************************/
+UBYTE EPD_7IN5_V2_ReadStatus(void)
+{
+    UBYTE Status;
+    EPD_SendReadCommand(0x71);
+    EPD_ReadData(&Status, 1);
+    return Status;
+}
+
+/******************************************************************************
+function :	Read the panel temperature from the internal sensor
+parameter:
+info:
+    The panel must be initialized (powered on). Returns whole degrees Celsius,
+    the fraction in the second byte is dropped
+******************************************************************************/
+int8_t EPD_7IN5_V2_ReadTemperature(void)
+{
+    UBYTE Data[2];
+
+    EPD_SendReadCommand(0x40);		//TEMPERATURE SENSOR CALIBRATION
+    EPD_WaitUntilIdle();            //busy while measuring
+    EPD_ReadData(Data, 2);
+    return (int8_t)Data[0];
+}
+
+/******************************************************************************
+function :	Pick the refresh mode that is safe at a temperature
+parameter:
+    Mode        : The requested mode
+    Temperature : Panel temperature in degrees Celsius
+info:
+    The fast and partial waveforms are tuned for room temperature. When the
+    panel is cold they leave ghosting or do not finish, so use a full refresh
+******************************************************************************/
+EPD_7IN5_V2_MODE EPD_7IN5_V2_SelectMode(EPD_7IN5_V2_MODE Mode, int8_t Temperature)
+{
+    if((Mode == EPD_7IN5_V2_MODE_FAST || Mode == EPD_7IN5_V2_MODE_PART) &&
+        Temperature < EPD_7IN5_V2_FAST_MIN_TEMP) {
+        Debug("Panel at %d C, using the full refresh\r\n", Temperature);
+        return EPD_7IN5_V2_MODE_FULL;
+    }
+    return Mode;
+}
+
+/******************************************************************************
+function :	Estimate how long a refresh takes
+parameter:
+    Mode        : Refresh mode
+    Temperature : Panel temperature in degrees Celsius
+info:
+    Typical times at room temperature, the waveforms get longer in the cold
+******************************************************************************/
+UDOUBLE EPD_7IN5_V2_RefreshTime_ms(EPD_7IN5_V2_MODE Mode, int8_t Temperature)
+{
+    UDOUBLE Time;
+
+    switch(Mode) {
+    case EPD_7IN5_V2_MODE_FAST:
+        Time = 1500;
+        break;
+    case EPD_7IN5_V2_MODE_PART:
+        Time = 400;
+        break;
+    case EPD_7IN5_V2_MODE_4GRAY:
+        Time = 4500;
+        break;
+    default:
+        Time = 5000;
+        break;
+    }
+
+    if(Temperature < 0)
+        Time *= 3;
+    else if(Temperature < 10)
+        Time *= 2;
+    else if(Temperature < 20)
+        Time = Time * 3 / 2;
+
+    return Time;
+}
+
+/******************************************************************************
+function :	Initialize the e-Paper register for a refresh mode
+parameter:
+******************************************************************************/
+UBYTE EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE Mode)
+{
+    switch(Mode) {
+    case EPD_7IN5_V2_MODE_FAST:
+        return EPD_7IN5_V2_Init_Fast();
+    case EPD_7IN5_V2_MODE_PART:
+        return EPD_7IN5_V2_Init_Part();
+    case EPD_7IN5_V2_MODE_4GRAY:
+        return EPD_7IN5_V2_Init_4Gray();
+    default:
+        return EPD_7IN5_V2_Init();
+    }
+}
+
 /******************************************************************************
 function :	Initialize the e-Paper register
 parameter:
@@ -244,6 +432,93 @@ UBYTE EPD_7IN5_V2_Init_4Gray(void)
     return 0;
 }
 
+/******************************************************************************
+function :	Initialize the e-Paper register with a waveform profile
+parameter:
+    Lut : One of EPD_7IN5_V2_Luts
+info:
+    Same as EPD_7IN5_V2_Init, but the panel setting selects the LUT registers
+******************************************************************************/
+UBYTE EPD_7IN5_V2_Init_Lut(const EPD_7IN5_V2_LUT *Lut)
+{
+    EPD_Reset();
+    EPD_SendCommand(0x01);			//POWER SETTING
+	EPD_SendData(0x07);
+	EPD_SendData(0x07);    //VGH=20V,VGL=-20V
+	EPD_SendData(0x3f);		//VDH=15V
+	EPD_SendData(0x3f);		//VDL=-15V
+
+	EPD_SendCommand(0x06);			//Booster Soft Start 
+	EPD_SendData(0x17);
+	EPD_SendData(0x17);   
+	EPD_SendData(0x28);		
+	EPD_SendData(0x17);	
+
+	EPD_SendCommand(0x04); //POWER ON
+	DEV_Delay_ms(100); 
+	EPD_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
+
+	EPD_SendCommand(0X00);			//PANNEL SETTING
+	EPD_SendData(0x3F);   //KW-3f: LUT from register
+
+	EPD_SendCommand(0x61);        	//tres			
+	EPD_SendData(0x03);		//source 800
+	EPD_SendData(0x20);
+	EPD_SendData(0x01);		//gate 480
+	EPD_SendData(0xE0);  
+
+	EPD_SendCommand(0X15);		
+	EPD_SendData(0x00);		
+
+    EPD_SendCommand(0X50);			
+	EPD_SendData(0x10);
+	EPD_SendData(0x07);
+	EPD_SendCommand(0X60);			//TCON SETTING
+	EPD_SendData(0x22);
+
+    EPD_7IN5_V2_Load_Lut(Lut);
+    return 0;
+}
+
+/******************************************************************************
+function :	Load a waveform profile into the LUT registers
+parameter:
+    Lut : One of EPD_7IN5_V2_Luts
+******************************************************************************/
+void EPD_7IN5_V2_Load_Lut(const EPD_7IN5_V2_LUT *Lut)
+{
+    UBYTE i;
+
+    EPD_SendCommand(0x30);			//PLL, frame rate
+    EPD_SendData(Lut->Pll);
+    EPD_SendCommand(0x82);			//VCOM DC
+    EPD_SendData(Lut->VcomDc);
+
+    for(i = 0; i < 5; i++) {
+        EPD_SendCommand(0x20 + i);	//LUTC, LUTWW, LUTBW, LUTWB, LUTBB
+        EPD_SendData2((UBYTE *)Lut->Lut[i], EPD_7IN5_V2_LUT_SIZE);
+    }
+}
+
+/******************************************************************************
+function :	Duration of a refresh with a waveform profile
+parameter:
+    Lut : One of EPD_7IN5_V2_Luts
+info:
+    Counts the frames of the VCOM LUT, which spans the whole waveform
+******************************************************************************/
+UDOUBLE EPD_7IN5_V2_Lut_Time_ms(const EPD_7IN5_V2_LUT *Lut)
+{
+    UDOUBLE Frames = 0;
+    const UBYTE *Group = Lut->Lut[0];
+    UBYTE i;
+
+    for(i = 0; i < EPD_7IN5_V2_LUT_SIZE; i += 6) {
+        Frames += (UDOUBLE)(Group[i + 1] + Group[i + 2] + Group[i + 3] + Group[i + 4]) * Group[i + 5];
+    }
+    return Frames * 1000 / Lut->FrameRate;
+}
+
 /******************************************************************************
 function :	Clear screen
 parameter:
@@ -307,15 +582,19 @@ void EPD_7IN5_V2_ClearBlack(void)
 }
 
 /******************************************************************************
-function :	Sends the image buffer in RAM to e-Paper and displays
+function :	Sends the image buffer in RAM to e-Paper RAM
 parameter:
+info:
+    The new data plane is the inverted image. It is inverted line by line,
+    the image buffer itself is left untouched
 ******************************************************************************/
-void EPD_7IN5_V2_Display(UBYTE *blackimage)
+static void EPD_7IN5_V2_SendImage(const UBYTE *blackimage)
 {
     UDOUBLE Width, Height;
     Width =(EPD_7IN5_V2_WIDTH % 8 == 0)?(EPD_7IN5_V2_WIDTH / 8 ):(EPD_7IN5_V2_WIDTH / 8 + 1);
     Height = EPD_7IN5_V2_HEIGHT;
-	
+    UBYTE line[EPD_7IN5_V2_WIDTH / 8];
+
     EPD_SendCommand(0x10);
     for (UDOUBLE j = 0; j < Height; j++) {
         EPD_SendData2((UBYTE *)(blackimage+j*Width), Width);
@@ -324,21 +603,45 @@ void EPD_7IN5_V2_Display(UBYTE *blackimage)
     EPD_SendCommand(0x13);
     for (UDOUBLE j = 0; j < Height; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            blackimage[i + j * Width] = ~blackimage[i + j * Width];
+            line[i] = ~blackimage[i + j * Width];
         }
+        EPD_SendData2(line, Width);
     }
-    for (UDOUBLE j = 0; j < Height; j++) {
-        EPD_SendData2((UBYTE *)(blackimage+j*Width), Width);
-    }
+}
+
+/******************************************************************************
+function :	Sends the image buffer in RAM to e-Paper and displays
+parameter:
+******************************************************************************/
+void EPD_7IN5_V2_Display(UBYTE *blackimage)
+{
+    EPD_7IN5_V2_SendImage(blackimage);
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
-void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+/******************************************************************************
+function :	Sends the image buffer to e-Paper and starts the refresh
+parameter:
+info:
+    Returns without waiting for the refresh. Start every panel, then
+    call EPD_7IN5_V2_WaitUntilIdle_All before talking to them again
+******************************************************************************/
+void EPD_7IN5_V2_Display_Start(const UBYTE *blackimage)
 {
-    UDOUBLE Width, Height;
-    Width =((x_end - x_start) % 8 == 0)?((x_end - x_start) / 8 ):((x_end - x_start) / 8 + 1);
-    Height = y_end - y_start;
+    EPD_7IN5_V2_SendImage(blackimage);
+    EPD_SendCommand(0x12);			//DISPLAY REFRESH
+}
 
+/******************************************************************************
+function :	Enter partial mode on a window of the panel
+parameter:
+    x_start : First column, a multiple of 8
+    y_start : First row
+    x_end   : Column after the window, a multiple of 8
+    y_end   : Row after the window
+******************************************************************************/
+static void EPD_7IN5_V2_SetPartWindow(UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+{
     EPD_SendCommand(0x50);
 	EPD_SendData(0xA9);
 	EPD_SendData(0x07);
@@ -348,16 +651,25 @@ void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start
 	EPD_SendData (x_start/256);
 	EPD_SendData (x_start%256);   //x-start    
 
-	EPD_SendData (x_end/256);		
-	EPD_SendData (x_end%256-1);  //x-end	
+	EPD_SendData ((x_end-1)/256);
+	EPD_SendData ((x_end-1)%256);  //x-end
 
 	EPD_SendData (y_start/256);  //
 	EPD_SendData (y_start%256);   //y-start    
 
-	EPD_SendData (y_end/256);		
-	EPD_SendData (y_end%256-1);  //y-end
+	EPD_SendData ((y_end-1)/256);
+	EPD_SendData ((y_end-1)%256);  //y-end
 	EPD_SendData (0x01);
-    
+}
+
+void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+{
+    UDOUBLE Width, Height;
+    Width =((x_end - x_start) % 8 == 0)?((x_end - x_start) / 8 ):((x_end - x_start) / 8 + 1);
+    Height = y_end - y_start;
+
+    EPD_7IN5_V2_SetPartWindow(x_start, y_start, x_end, y_end);
+
     EPD_SendCommand(0x13);
     for (UDOUBLE j = 0; j < Height; j++) {
         EPD_SendData2((UBYTE *)(blackimage+j*Width), Width);
@@ -365,85 +677,108 @@ void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
+/******************************************************************************
+function :	Sends a window of the image buffer, without refreshing it
+parameter:
+    blackimage : The whole image
+    x_start    : First column, rounded down to a multiple of 8
+    y_start    : First row
+    x_end      : Column after the window, rounded up to a multiple of 8
+    y_end      : Row after the window
+info:
+    Returns 0 when the window is empty and nothing was sent
+******************************************************************************/
+static UBYTE EPD_7IN5_V2_SendWindow(const UBYTE *blackimage, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+{
+    UDOUBLE Width, Bytes, j;
+    Width =(EPD_7IN5_V2_WIDTH % 8 == 0)?(EPD_7IN5_V2_WIDTH / 8 ):(EPD_7IN5_V2_WIDTH / 8 + 1);
+
+    x_start -= x_start % 8;
+    x_end = (x_end + 7) / 8 * 8;
+    if (x_end > Width * 8)
+        x_end = Width * 8;
+    if (y_end > EPD_7IN5_V2_HEIGHT)
+        y_end = EPD_7IN5_V2_HEIGHT;
+    if (x_start >= x_end || y_start >= y_end)
+        return 0;
+    Bytes = (x_end - x_start) / 8;
+
+    EPD_7IN5_V2_SetPartWindow(x_start, y_start, x_end, y_end);
+
+    EPD_SendCommand(0x13);
+    for (j = y_start; j < y_end; j++) {
+        EPD_SendData2((UBYTE *)(blackimage + j * Width + x_start / 8), Bytes);
+    }
+    return 1;
+}
+
+/******************************************************************************
+function :	Sends a window of the image buffer and refreshes only that window
+parameter:
+    blackimage : The whole image
+    x_start    : First column, rounded down to a multiple of 8
+    y_start    : First row
+    x_end      : Column after the window, rounded up to a multiple of 8
+    y_end      : Row after the window
+info:
+    Needs EPD_7IN5_V2_Init_Part. EPD_7IN5_V2_Display_Part takes the
+    window packed on its own, this one sends its rows out of the whole
+    image, such as the region Paint_GetDirty returns
+******************************************************************************/
+void EPD_7IN5_V2_Display_Window(const UBYTE *blackimage, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+{
+    if (EPD_7IN5_V2_SendWindow(blackimage, x_start, y_start, x_end, y_end))
+        EPD_7IN5_V2_TurnOnDisplay();
+}
+
+/******************************************************************************
+function :	Sends a window of the image buffer and starts refreshing it
+parameter:
+    blackimage : The whole image
+    x_start    : First column, rounded down to a multiple of 8
+    y_start    : First row
+    x_end      : Column after the window, rounded up to a multiple of 8
+    y_end      : Row after the window
+info:
+    EPD_7IN5_V2_Display_Window without the wait, see EPD_7IN5_V2_Display_Start.
+    Returns 0 when the window is empty and no refresh was started
+******************************************************************************/
+UBYTE EPD_7IN5_V2_Display_Window_Start(const UBYTE *blackimage, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+{
+    if (!EPD_7IN5_V2_SendWindow(blackimage, x_start, y_start, x_end, y_end))
+        return 0;
+    EPD_SendCommand(0x12);			//DISPLAY REFRESH
+    return 1;
+}
+
 void EPD_7IN5_V2_Display_4Gray(const UBYTE *Image)
 {
-    UDOUBLE i,j,k;
-    UBYTE temp1,temp2,temp3;
+    UDOUBLE Width, Height;
+    Width =(EPD_7IN5_V2_WIDTH % 8 == 0)?(EPD_7IN5_V2_WIDTH / 8 ):(EPD_7IN5_V2_WIDTH / 8 + 1);
+    Height = EPD_7IN5_V2_HEIGHT;
+    UBYTE line[EPD_7IN5_V2_WIDTH / 8];
+    const UBYTE *src;
+    UDOUBLE i, j;
 
     // old  data
     EPD_SendCommand(0x10);
-    for(i=0; i<48000; i++) {
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00)
-                    temp3 |= 0x01; 
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; 
-                else //0x40
-                    temp3 |= 0x00; 
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0) 
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00) 
-                    temp3 |= 0x01;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; 
-                else    //0x40
-                    temp3 |= 0x00;	
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
-
+    src = Image;
+    for (j = 0; j < Height; j++) {
+        for (i = 0; i < Width; i++) {
+            line[i] = (EPD_4Gray_LUT_Old[src[0]] << 4) | EPD_4Gray_LUT_Old[src[1]];
+            src += 2;
         }
-        EPD_SendData(temp3);
-        // printf("%x",temp3);
+        EPD_SendData2(line, Width);
     }
 
     EPD_SendCommand(0x13);   //write RAM for black(0)/white (1)
-    for(i=0; i<48000; i++) {             //5808*4  46464
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x00;//white
-                else if(temp2 == 0x00)
-                    temp3 |= 0x01;  //black
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00;  //gray1
-                else //0x40
-                    temp3 |= 0x01; //gray2
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)  //white
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00) //black
-                    temp3 |= 0x01;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00; //gray1
-                else    //0x40
-                    temp3 |= 0x01;	//gray2
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
+    src = Image;
+    for (j = 0; j < Height; j++) {
+        for (i = 0; i < Width; i++) {
+            line[i] = (EPD_4Gray_LUT_New[src[0]] << 4) | EPD_4Gray_LUT_New[src[1]];
+            src += 2;
         }
-        EPD_SendData(temp3);
-        // printf("%x",temp3);
+        EPD_SendData2(line, Width);
     }
 
     EPD_7IN5_V2_TurnOnDisplay();
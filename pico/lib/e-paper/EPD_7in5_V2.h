@@ -40,14 +40,53 @@
 #define EPD_7IN5_V2_WIDTH       800
 #define EPD_7IN5_V2_HEIGHT      480
 
+// Refresh modes
+typedef enum {
+    EPD_7IN5_V2_MODE_FULL = 0,
+    EPD_7IN5_V2_MODE_FAST,
+    EPD_7IN5_V2_MODE_PART,
+    EPD_7IN5_V2_MODE_4GRAY,
+} EPD_7IN5_V2_MODE;
+
+// Below this temperature (C) the fast and partial waveforms are not used
+#define EPD_7IN5_V2_FAST_MIN_TEMP   10
+
+// Waveform profile, loaded into the LUT registers. EXPERIMENTAL: the profiles in
+// EPD_7IN5_V2_Luts are untuned starting points, not vendor waveforms; check the
+// image quality and ghosting on the panel batch before relying on them
+#define EPD_7IN5_V2_LUT_SIZE        42
+typedef struct {
+    const char *Name;
+    EPD_7IN5_V2_MODE Mode;          // FULL, FAST or PART: how the frame is sent and when it is too cold
+    UBYTE Pll;                      // Frame rate register (0x30)
+    UBYTE FrameRate;                // Frames per second set by Pll
+    UBYTE VcomDc;                   // VCOM DC register (0x82)
+    UBYTE Lut[5][EPD_7IN5_V2_LUT_SIZE];    // VCOM, WW, BW, WB, BB
+} EPD_7IN5_V2_LUT;
+
+extern const EPD_7IN5_V2_LUT EPD_7IN5_V2_Luts[];
+extern const UBYTE EPD_7IN5_V2_Lut_Count;
+
 UBYTE EPD_7IN5_V2_Init(void);
 UBYTE EPD_7IN5_V2_Init_Fast(void);
 UBYTE EPD_7IN5_V2_Init_Part(void);
 UBYTE EPD_7IN5_V2_Init_4Gray(void);
+UBYTE EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE Mode);
+UBYTE EPD_7IN5_V2_Init_Lut(const EPD_7IN5_V2_LUT *Lut);
+void EPD_7IN5_V2_Load_Lut(const EPD_7IN5_V2_LUT *Lut);
+UDOUBLE EPD_7IN5_V2_Lut_Time_ms(const EPD_7IN5_V2_LUT *Lut);
+UBYTE EPD_7IN5_V2_ReadStatus(void);
+int8_t EPD_7IN5_V2_ReadTemperature(void);
+EPD_7IN5_V2_MODE EPD_7IN5_V2_SelectMode(EPD_7IN5_V2_MODE Mode, int8_t Temperature);
+UDOUBLE EPD_7IN5_V2_RefreshTime_ms(EPD_7IN5_V2_MODE Mode, int8_t Temperature);
 void EPD_7IN5_V2_Clear(void);
 void EPD_7IN5_V2_ClearBlack(void);
 void EPD_7IN5_V2_Display(UBYTE *blackimage);
+void EPD_7IN5_V2_Display_Start(const UBYTE *blackimage);
+void EPD_7IN5_V2_WaitUntilIdle_All(UBYTE PanelMask);
 void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end);
+void EPD_7IN5_V2_Display_Window(const UBYTE *blackimage, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end);
+UBYTE EPD_7IN5_V2_Display_Window_Start(const UBYTE *blackimage, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end);
 void EPD_7IN5_V2_Display_4Gray(const UBYTE *Image);
 void EPD_7IN5_V2_Sleep(void);
 
@@ -0,0 +1,104 @@
+/*****************************************************************************
+* | File      	:	EPD_7in5_V2_Lut.c
+* | Function    :   Waveform profiles for the 7.5inch e-paper V2
+* | Info        :
+*   Loaded into the LUT registers by EPD_7IN5_V2_Init_Lut instead of the
+*   waveforms in OTP. Every LUT has 7 groups of 6 bytes:
+*   level select (2 bits per phase: 00 VCOM_DC, 01 VDH black, 10 VDL white),
+*   frames in phase A, B, C, D and the repeat count of the group.
+*   EXPERIMENTAL: the tables are untuned starting points, not vendor
+*   waveforms. Tune them per panel batch before relying on them.
+******************************************************************************/
+#include "EPD_7in5_V2.h"
+
+const EPD_7IN5_V2_LUT EPD_7IN5_V2_Luts[] = {
+    /*
+        Full refresh with three flashing groups. Clears ghosting,
+        about 2.5s at room temperature
+    */
+    {
+        "clean-full", EPD_7IN5_V2_MODE_FULL, 0x06, 50, 0x24,
+        {
+            {   //VCOM
+                0x00, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+                0x00, 0x0F, 0x01, 0x0F, 0x01, 0x02,
+                0x00, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+            },
+            {   //WW
+                0x10, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+                0x84, 0x0F, 0x01, 0x0F, 0x01, 0x02,
+                0x20, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+            },
+            {   //BW
+                0x10, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+                0x84, 0x0F, 0x01, 0x0F, 0x01, 0x02,
+                0x20, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+            },
+            {   //WB
+                0x80, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+                0x84, 0x0F, 0x01, 0x0F, 0x01, 0x02,
+                0x40, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+            },
+            {   //BB
+                0x80, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+                0x84, 0x0F, 0x01, 0x0F, 0x01, 0x02,
+                0x40, 0x0F, 0x0F, 0x00, 0x00, 0x01,
+            },
+        },
+    },
+    /*
+        Full frame, one flash and a short settle. About 0.5s,
+        leaves some ghosting after many updates
+    */
+    {
+        "fast-full", EPD_7IN5_V2_MODE_FAST, 0x06, 50, 0x24,
+        {
+            {   //VCOM
+                0x00, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+                0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //WW
+                0x60, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+                0x80, 0x05, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //BW
+                0x60, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+                0x80, 0x05, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //WB
+                0x90, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+                0x40, 0x05, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //BB
+                0x90, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+                0x40, 0x05, 0x00, 0x00, 0x00, 0x01,
+            },
+        },
+    },
+    /*
+        Partial refresh that only drives the pixels that change,
+        for tickers and clocks. About 0.2s
+    */
+    {
+        "fast-partial-ticker", EPD_7IN5_V2_MODE_PART, 0x06, 50, 0x24,
+        {
+            {   //VCOM
+                0x00, 0x0A, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //WW
+                0x00, 0x0A, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //BW
+                0x80, 0x0A, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //WB
+                0x40, 0x0A, 0x00, 0x00, 0x00, 0x01,
+            },
+            {   //BB
+                0x00, 0x0A, 0x00, 0x00, 0x00, 0x01,
+            },
+        },
+    },
+};
+
+const UBYTE EPD_7IN5_V2_Lut_Count = sizeof(EPD_7IN5_V2_Luts) / sizeof(EPD_7IN5_V2_LUT);
@@ -0,0 +1,360 @@
+#include "displayList.h"
+#include "GUI_Paint.h"
+#include "GUI_Barcode.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// A bitmap kept between lists, its bits are in slotMemory
+typedef struct {
+    UWORD width;
+    UWORD height;
+    UWORD offset;
+    UWORD size;     // Bytes reserved, 0 when the slot was never loaded
+} bitmapSlot;
+
+typedef struct {
+    const UBYTE *data;
+    UDOUBLE length;
+    UDOUBLE index;
+    bool failed;    // Read past the end of the list
+} listReader;
+
+static bitmapSlot slots[DL_SLOTS];
+static UDOUBLE slotMemoryUsed;
+static UBYTE slotMemory[DL_SLOT_MEMORY];
+static QR_WORKSPACE qrWork;
+
+static sFONT* const listFonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define LIST_FONT_COUNT (sizeof(listFonts) / sizeof(listFonts[0]))
+
+// Numbered after listFonts
+static pFONT* const listPropFonts[] = {&Font8P, &Font12P, &Font16P, &Font20P, &Font24P};
+#define LIST_PROP_FONT_COUNT (sizeof(listPropFonts) / sizeof(listPropFonts[0]))
+
+// Numbered after listPropFonts
+static aFONT* const listAAFonts[] = {&Font8AA, &Font10AA, &Font12AA};
+#define LIST_AA_FONT_COUNT (sizeof(listAAFonts) / sizeof(listAAFonts[0]))
+
+
+static const UBYTE* readBytes(listReader *reader, UDOUBLE count){
+
+    if(reader->failed || count > reader->length - reader->index){
+        reader->failed = true;
+        return NULL;
+    }
+    const UBYTE *bytes = reader->data + reader->index;
+    reader->index += count;
+    return bytes;
+}
+
+
+static UBYTE readByte(listReader *reader){
+
+    const UBYTE *bytes = readBytes(reader, 1);
+    return (bytes != NULL)? bytes[0]: 0;
+}
+
+
+static UWORD readWord(listReader *reader){
+
+    const UBYTE *bytes = readBytes(reader, 2);
+    return (bytes != NULL)? (UWORD)(bytes[0] | (bytes[1] << 8)): 0;
+}
+
+
+static int32_t readInt32(listReader *reader){
+
+    const UBYTE *bytes = readBytes(reader, 4);
+    if(bytes == NULL){
+        return 0;
+    }
+    return (int32_t)((UDOUBLE)bytes[0] | ((UDOUBLE)bytes[1] << 8) | ((UDOUBLE)bytes[2] << 16) | ((UDOUBLE)bytes[3] << 24));
+}
+
+
+// A slot keeps its memory when the new bitmap fits, else it gets new memory after the used part
+static bool placeSlot(bitmapSlot *table, UDOUBLE *used, UBYTE slot, UWORD width, UWORD height){
+
+    UDOUBLE size = (UDOUBLE)(width + 7) / 8 * height;
+
+    if(size > table[slot].size){
+        if(size > DL_SLOT_MEMORY - *used){
+            return false;
+        }
+        table[slot].offset = *used;
+        table[slot].size = size;
+        *used += size;
+    }
+    table[slot].width = width;
+    table[slot].height = height;
+    return true;
+}
+
+
+// Runs the ops of a list. Without draw only checks them, against copies of the slot table
+static const char* runList(PAINT *paint, const UBYTE *list, UDOUBLE length, bitmapSlot *table, UDOUBLE *used, bool draw){
+
+    listReader reader = {list, length, 0, false};
+    UBYTE clipDepth = 0;
+    const char* error = NULL;
+
+    while((error == NULL) && (reader.index < length)){
+
+        UBYTE op = readByte(&reader);
+        switch(op){
+            case DL_OP_CLEAR:{
+                UBYTE color = readByte(&reader);
+                if(draw){
+                    PaintCtx_Clear(paint, color);
+                }
+                break;
+            }
+            case DL_OP_RECT:
+            case DL_OP_LINE:
+            case DL_OP_ROUNDED_RECT:{
+                UWORD x0 = readWord(&reader);
+                UWORD y0 = readWord(&reader);
+                UWORD x1 = readWord(&reader);
+                UWORD y1 = readWord(&reader);
+                UWORD radius = (op == DL_OP_ROUNDED_RECT)? readWord(&reader): 0;
+                UBYTE color = readByte(&reader);
+                UBYTE lineWidth = readByte(&reader);
+                UBYTE flag = readByte(&reader);
+                if(lineWidth < DOT_PIXEL_1X1 || lineWidth > DOT_PIXEL_8X8){
+                    error = "Invalid line width";
+                }
+                else if(draw){
+                    if(op == DL_OP_RECT){
+                        PaintCtx_DrawRectangle(paint, x0, y0, x1, y1, color, lineWidth, flag? DRAW_FILL_FULL: DRAW_FILL_EMPTY);
+                    }
+                    else if(op == DL_OP_LINE){
+                        PaintCtx_DrawLine(paint, x0, y0, x1, y1, color, lineWidth, flag? LINE_STYLE_DOTTED: LINE_STYLE_SOLID);
+                    }
+                    else{
+                        PaintCtx_DrawRoundedRectangle(paint, x0, y0, x1, y1, radius, color, lineWidth, flag? DRAW_FILL_FULL: DRAW_FILL_EMPTY);
+                    }
+                }
+                break;
+            }
+            case DL_OP_CIRCLE:{
+                UWORD x = readWord(&reader);
+                UWORD y = readWord(&reader);
+                UWORD radius = readWord(&reader);
+                UBYTE color = readByte(&reader);
+                UBYTE lineWidth = readByte(&reader);
+                UBYTE fill = readByte(&reader);
+                if(lineWidth < DOT_PIXEL_1X1 || lineWidth > DOT_PIXEL_8X8){
+                    error = "Invalid line width";
+                }
+                else if(draw){
+                    PaintCtx_DrawCircle(paint, x, y, radius, color, lineWidth, fill? DRAW_FILL_FULL: DRAW_FILL_EMPTY);
+                }
+                break;
+            }
+            case DL_OP_TEXT:
+            case DL_OP_NUMBER:{
+                // Room for the longest text and for any int32
+                char text[256];
+                UWORD x = readWord(&reader);
+                UWORD y = readWord(&reader);
+                UBYTE font = readByte(&reader);
+                UBYTE scale = (font >> 4) + 1;
+                UBYTE foreground = readByte(&reader);
+                UBYTE background = readByte(&reader);
+                if(op == DL_OP_TEXT){
+                    UBYTE textLength = readByte(&reader);
+                    const UBYTE *characters = readBytes(&reader, textLength);
+                    if(characters != NULL){
+                        memcpy(text, characters, textLength);
+                    }
+                    text[textLength] = '\0';
+                    for(UWORD i = 0; i < textLength; i++){
+                        if(text[i] < ' ' || text[i] > '~'){
+                            error = "Text has a character the fonts do not have";
+                        }
+                    }
+                }
+                else{
+                    snprintf(text, sizeof(text), "%ld", (long)readInt32(&reader));
+                }
+                font &= 0x0F;
+                if(font >= LIST_FONT_COUNT + LIST_PROP_FONT_COUNT + LIST_AA_FONT_COUNT){
+                    error = "Unknown font";
+                }
+                else if(scale > PAINT_TEXT_SCALE_MAX || (scale > 1 && font >= LIST_FONT_COUNT)){
+                    error = "Invalid text scale";
+                }
+                else if(draw && error == NULL){
+                    if(font < LIST_FONT_COUNT){
+                        PaintCtx_DrawString_Scaled(paint, x, y, text, listFonts[font], scale, foreground, background);
+                    }
+                    else if(font < LIST_FONT_COUNT + LIST_PROP_FONT_COUNT){
+                        PaintCtx_DrawString_Prop(paint, x, y, text, listPropFonts[font - LIST_FONT_COUNT], foreground, background);
+                    }
+                    else{
+                        PaintCtx_DrawString_AA(paint, x, y, text, listAAFonts[font - LIST_FONT_COUNT - LIST_PROP_FONT_COUNT], foreground, background);
+                    }
+                }
+                break;
+            }
+            case DL_OP_LOAD_SLOT:{
+                UBYTE slot = readByte(&reader);
+                UWORD width = readWord(&reader);
+                UWORD height = readWord(&reader);
+                const UBYTE *bits = readBytes(&reader, (UDOUBLE)(width + 7) / 8 * height);
+                if(slot >= DL_SLOTS){
+                    error = "Invalid slot";
+                }
+                else if(width == 0 || height == 0){
+                    error = "Empty bitmap";
+                }
+                else if(bits != NULL){
+                    if(!placeSlot(table, used, slot, width, height)){
+                        error = "Slot memory is full";
+                    }
+                    else if(draw){
+                        memcpy(&slotMemory[table[slot].offset], bits, (UDOUBLE)(width + 7) / 8 * height);
+                    }
+                }
+                break;
+            }
+            case DL_OP_BLIT:{
+                UBYTE slot = readByte(&reader);
+                UWORD x = readWord(&reader);
+                UWORD y = readWord(&reader);
+                UBYTE foreground = readByte(&reader);
+                UBYTE background = readByte(&reader);
+                UBYTE transparent = readByte(&reader);
+                if(slot >= DL_SLOTS || table[slot].size == 0){
+                    error = "Blit from an empty slot";
+                }
+                else if(draw){
+                    PaintCtx_BlitBitmap(paint, x, y, &slotMemory[table[slot].offset], table[slot].width, table[slot].height,
+                                        (table[slot].width + 7) / 8, foreground, background, transparent? 1: 0);
+                }
+                break;
+            }
+            case DL_OP_PUSH_CLIP:{
+                UWORD x0 = readWord(&reader);
+                UWORD y0 = readWord(&reader);
+                UWORD x1 = readWord(&reader);
+                UWORD y1 = readWord(&reader);
+                if(clipDepth >= PAINT_CLIP_DEPTH){
+                    error = "Too many clips";
+                }
+                else{
+                    if(draw){
+                        PaintCtx_PushClip(paint, x0, y0, x1, y1);
+                    }
+                    clipDepth++;
+                }
+                break;
+            }
+            case DL_OP_POP_CLIP:
+                if(clipDepth == 0){
+                    error = "Clip popped that was not pushed";
+                }
+                else{
+                    if(draw){
+                        PaintCtx_PopClip(paint);
+                    }
+                    clipDepth--;
+                }
+                break;
+            case DL_OP_QR:
+            case DL_OP_CODE128:{
+                UWORD x = readWord(&reader);
+                UWORD y = readWord(&reader);
+                UBYTE module = readByte(&reader);
+                UBYTE ecc = (op == DL_OP_QR)? readByte(&reader): 0;
+                UWORD height = (op == DL_OP_CODE128)? readWord(&reader): 0;
+                UBYTE foreground = readByte(&reader);
+                UBYTE background = readByte(&reader);
+                UWORD dataLength = (op == DL_OP_QR)? readWord(&reader): readByte(&reader);
+                const UBYTE *data = readBytes(&reader, dataLength);
+                if(data == NULL){
+                    break;
+                }
+                // Pixels of the symbol with its quiet zones
+                UDOUBLE width = 0, symbolHeight = height;
+                if(op == DL_OP_QR){
+                    UBYTE size = Barcode_QRSize(dataLength, (QR_ECC)ecc);
+                    if(ecc > QR_ECC_H){
+                        error = "Unknown QR error correction level";
+                    }
+                    else if(size == 0){
+                        error = "QR payload too long";
+                    }
+                    width = symbolHeight = (UDOUBLE)(size + 2 * QR_QUIET_ZONE) * module;
+                }
+                else{
+                    UWORD modules = Barcode_Code128Width(data, dataLength);
+                    if(modules == 0){
+                        error = "Code128 cannot encode the payload";
+                    }
+                    width = (UDOUBLE)(modules + 2 * CODE128_QUIET_ZONE) * module;
+                }
+                if(error != NULL){
+                    break;
+                }
+                if(module == 0 || symbolHeight == 0){
+                    error = "Invalid barcode size";
+                }
+                else if(x + width > 0xFFFF || y + symbolHeight > 0xFFFF){
+                    error = "Barcode does not fit";
+                }
+                else if(draw){
+                    if(op == DL_OP_QR){
+                        BarcodeCtx_DrawQR(paint, &qrWork, x, y, data, dataLength, (QR_ECC)ecc, module, foreground, background);
+                    }
+                    else{
+                        BarcodeCtx_DrawCode128(paint, x, y, data, dataLength, module, height, foreground, background);
+                    }
+                }
+                break;
+            }
+            case DL_OP_RESET_SLOTS:
+                memset(table, 0, sizeof(bitmapSlot) * DL_SLOTS);
+                *used = 0;
+                break;
+            default:
+                error = "Unknown display list op";
+                break;
+        }
+        if(reader.failed){
+            error = "Display list ends inside an op";
+        }
+    }
+
+    // Clips do not outlive the list
+    while(clipDepth > 0){
+        if(draw){
+            PaintCtx_PopClip(paint);
+        }
+        clipDepth--;
+    }
+    return error;
+}
+
+
+// Draws a display list into paint, &Paint for the selected image. The whole list is checked first,
+// a list with an error draws nothing. Returns NULL, or the error
+const char* displayList_render(PAINT *paint, const UBYTE *list, UDOUBLE length){
+
+    bitmapSlot checkSlots[DL_SLOTS];
+    UDOUBLE checkUsed = slotMemoryUsed;
+    memcpy(checkSlots, slots, sizeof(slots));
+
+    const char* error = runList(paint, list, length, checkSlots, &checkUsed, false);
+    if(error != NULL){
+        return error;
+    }
+    return runList(paint, list, length, slots, &slotMemoryUsed, true);
+}
+
+
+void displayList_resetSlots(void){
+    memset(slots, 0, sizeof(slots));
+    slotMemoryUsed = 0;
+}
@@ -0,0 +1,36 @@
+#ifndef DISPLAYLIST_H
+#define DISPLAYLIST_H
+
+#include "DEV_Config.h"
+#include "GUI_Paint.h"
+
+// A display list is a sequence of ops, each an op code followed by its arguments.
+// x, y, sizes and lengths are 16 bit little endian, colors, fonts and flags one byte.
+// Colors are 0x00 black and 0xFF white, fonts 0..4 are Font8, 12, 16, 20 and 24,
+// fonts 5..9 their proportional versions Font8P .. Font24P, fonts 10..12 the anti-aliased
+// Font8AA, Font10AA and Font12AA. The high nibble of the font byte is the text scale - 1,
+// 0..7 for fonts 0..4, 0 for the others. Barcodes are drawn with their quiet zones, x y is the
+// top left of the zone. The QR ecc byte is 0..3 for levels L, M, Q and H
+#define DL_OP_CLEAR             0x01    // color
+#define DL_OP_RECT              0x02    // x0 y0 x1 y1 color lineWidth fill
+#define DL_OP_LINE              0x03    // x0 y0 x1 y1 color lineWidth dotted
+#define DL_OP_CIRCLE            0x04    // x y radius color lineWidth fill
+#define DL_OP_TEXT              0x05    // x y font foreground background length(1) characters
+#define DL_OP_NUMBER            0x06    // x y font foreground background value(int32)
+#define DL_OP_LOAD_SLOT         0x07    // slot(1) width height bits, rows of (width + 7) / 8 bytes, 1 is foreground
+#define DL_OP_BLIT              0x08    // slot(1) x y foreground background transparent
+#define DL_OP_PUSH_CLIP         0x09    // x0 y0 x1 y1, x1 and y1 not included, PAINT_CLIP_DEPTH deep at most
+#define DL_OP_POP_CLIP          0x0A
+#define DL_OP_ROUNDED_RECT      0x0B    // x0 y0 x1 y1 radius color lineWidth fill
+#define DL_OP_RESET_SLOTS       0x0C
+#define DL_OP_QR                0x0D    // x y module(1) ecc(1) foreground background length bytes
+#define DL_OP_CODE128           0x0E    // x y module(1) height foreground background length(1) characters, ASCII 0..127
+
+#define DL_MAX_BYTES            4096    // Longest list the device receives
+#define DL_SLOTS                16      // Bitmaps kept between lists for DL_OP_BLIT
+#define DL_SLOT_MEMORY          8192    // Bytes shared by all slots
+
+const char* displayList_render(PAINT *paint, const UBYTE *list, UDOUBLE length);
+void displayList_resetSlots(void);
+
+#endif
@@ -1,14 +1,22 @@
 #include "EPD_7in5_V2.h"
+#ifdef PICOPAPER_HOST_SIM
+// Host build, the board id comes from sim/DEV_Config_sim.c
+#include "DEV_Sim.h"
+#else
 #include "pico/time.h"
 #include "pico/stdlib.h"
 #include "pico/unique_id.h"
+#endif
 #include <math.h>
 
 #include "DEV_Config.h"
 #include "GUI_Paint.h"
+#include "GUI_Dither.h"
 #include "Debug.h"
 #include <stdlib.h>
+#include <string.h>
 #include "picoDisplay.h"
+#include "displayList.h"
 
 typedef enum rxByteStateEnum{
     WAITING_FOR_START,
@@ -18,6 +26,18 @@ typedef enum rxByteStateEnum{
 typedef enum rxFunctionStateEnum{
     RX_FUNCTION_IDLE,
     RX_FUNCTION_IMAGERX,
+    RX_FUNCTION_PANEL_SELECT,
+    RX_FUNCTION_REFRESH_MODE,
+    RX_FUNCTION_WAVEFORM,
+    RX_FUNCTION_DRAW_LIST_LENGTH,
+    RX_FUNCTION_DRAW_LIST,
+    RX_FUNCTION_DITHER_HEADER,
+    RX_FUNCTION_DITHER,
+    RX_FUNCTION_DITHER_OVERRUN,
+    RX_FUNCTION_LAYER_SELECT,
+    RX_FUNCTION_COMPOSE,
+    RX_FUNCTION_ROTATE,
+    RX_FUNCTION_DISCARD,
 } rxFunctionStates;
 
 rxByteStates rxByteState = WAITING_FOR_START; 
@@ -30,6 +50,15 @@ const char* ACK_IMAGE_RECEIVED_MSG = "IMG_RCVD\0";
 const char* ACK_CLEAR_DISPLAY_MSG = "CLR_SCR\0";
 const char* ACK_SPLASH_SCREEN_MSG = "SPLASH\0";
 const char* ACK_DISPLAY_IMG_BUFFER = "DISPLAY\0";
+const char* ACK_PANEL_SELECTED_MSG = "PANEL\0";
+const char* ACK_DISPLAY_ALL_PANELS = "DISPLAY_ALL\0";
+const char* ACK_REFRESH_MODE_MSG = "MODE\0";
+const char* ACK_WAVEFORM_MSG = "WAVEFORM\0";
+const char* ACK_DRAW_LIST_MSG = "DRAW_LIST\0";
+const char* ACK_IMAGE_DITHERED_MSG = "IMG_DITHERED\0";
+const char* ACK_LAYER_SELECTED_MSG = "LAYER\0";
+const char* ACK_LAYERS_COMPOSED_MSG = "COMPOSED\0";
+const char* ACK_IMAGE_ROTATED_MSG = "ROTATED\0";
 
 const char* ACK_MESSAGE_START = "~ACK#\0";
 const char* ERROR_MESSAGE_START = "~ERR#\0";
@@ -41,6 +70,28 @@ const UBYTE CMD_IMG_RX = 0x02;
 const UBYTE CMD_IMG_DISPLAY = 0x03;
 const UBYTE CMD_CLEAR_DISPLAY = 0x04;
 const UBYTE CMD_DISPLAY_SPLASH = 0x05;
+const UBYTE CMD_SELECT_PANEL = 0x06;
+const UBYTE CMD_IMG_DISPLAY_ALL = 0x07;
+const UBYTE CMD_SET_REFRESH_MODE = 0x08;
+const UBYTE CMD_STATUS = 0x09;
+const UBYTE CMD_SET_WAVEFORM = 0x0A;
+const UBYTE CMD_DRAW_LIST = 0x0B;
+const UBYTE CMD_IMG_DITHER = 0x0C;
+const UBYTE CMD_SELECT_LAYER = 0x0D;
+const UBYTE CMD_COMPOSE_LAYERS = 0x0E;
+const UBYTE CMD_ROTATE_IMAGE = 0x0F;
+
+#define WAVEFORM_STOCK 0xFF
+
+#define PANEL_TEMPERATURE_UNKNOWN INT8_MIN
+
+// CMD_IMG_DITHER header: x y width height, 16 bit little endian, then scale, mode and compression
+#define DITHER_HEADER_BYTES 11
+#define DITHER_COMPRESSION_NONE 0
+#define DITHER_COMPRESSION_PACKBITS 1
+
+#define LAYER_COUNT 3
+#define LAYER_FRAME 0xFF    // CMD_SELECT_LAYER argument for the image buffer of the selected panel
 
 
 const char* ident_device = "PicoPaper\0";
@@ -58,6 +109,9 @@ char* identString = "{"
 "\"version\":\"%s\","
 "\"id\":\"%s\","
 "\"board\":\"%s\","
+"\"panels\":%d,"
+"\"temperature\":%s,"
+"\"waveforms\":[%s],"
 "\"Display\":{"
 "\"type\":\"%s\","
 "\"size\":\"%s\","
@@ -70,12 +124,60 @@ char* identString = "{"
 "\"format\":\"%s\""
 "}}\0";
 
+char* statusString = "{"
+"\"panel\":%d,"
+"\"temperature\":%d,"
+"\"status\":%d,"
+"\"mode\":\"%s\","
+"\"waveform\":\"%s\","
+"\"refreshMs\":%lu"
+"}\0";
+
+const char* refreshModeNames[] = {"full\0", "fast\0", "partial\0", "4gray\0"};
+
 
 char messageByteString[3];
 int msgByteIndex = 0;
 UBYTE *BlackImage;
+UBYTE *PanelImages[EPD_MAX_PANELS];
 int imageRxIndex;
 UDOUBLE ImagesizeInBytes;
+EPD_7IN5_V2_MODE refreshMode = EPD_7IN5_V2_MODE_FULL;
+const EPD_7IN5_V2_LUT *waveform = NULL;
+int8_t panelTemperatures[EPD_MAX_PANELS];
+// What changed since the last refresh of each panel. Paint tracks the selected one,
+// the others are kept here until they are selected again
+PAINT_RECT panelDirty[EPD_MAX_PANELS];
+// A display list is received whole before it is drawn, bytes beyond DL_MAX_BYTES are dropped
+UBYTE drawList[DL_MAX_BYTES];
+UDOUBLE drawListLength;
+UDOUBLE drawListRxIndex;
+// A grayscale image is dithered into the image buffer row by row while it is received.
+// The rows may be a few pixels wider than the panel when they are scaled up
+UBYTE ditherHeader[DITHER_HEADER_BYTES];
+UDOUBLE ditherRxIndex;
+DITHER dither;
+const char* ditherFailure;      // The pixels are still received, then this error is sent
+UBYTE ditherCompression;
+UDOUBLE ditherPixelsLeft;
+UBYTE ditherRunLeft;            // Pixels left in the PackBits run, 0 when the next byte starts a run
+bool ditherRunRepeat;
+UBYTE ditherRow[EPD_7IN5_V2_WIDTH];
+UWORD ditherRowIndex;
+int16_t ditherErrors[DITHER_ERROR_SIZE(EPD_7IN5_V2_WIDTH + DITHER_SCALE_MAX - 1)];
+// Layers are full size images kept apart from the panels, a background drawn once and overlays
+// that change. CMD_COMPOSE_LAYERS combines them into the image buffer. The memory of a layer
+// is taken when it is first selected
+PAINT layers[LAYER_COUNT];
+// Where images, dithered images and display lists draw: &Paint, the selected panel, or a layer
+PAINT *drawTarget = &Paint;
+// CMD_ROTATE_IMAGE turns the draw target into this image and composes it back. The memory is
+// taken on the first rotation and kept, like the memory of the layers
+PAINT rotatedImage;
+// CMD_COMPOSE_LAYERS: the number of layers, then the index and BLIT_ROP of each layer.
+// Bytes beyond the last layer are dropped
+UBYTE composeArgs[1 + 2 * LAYER_COUNT];
+UDOUBLE composeRxIndex;
 
 void initialize(void);
 void listenOnUart(void);
@@ -87,6 +189,24 @@ void receiveNextImageByte(UBYTE msg);
 void runDisplayImageCommand(void);
 void runClearDisplayCommand(void);
 void runDisplaySplashScreenCommand(void);
+void runSelectPanelCommand(UBYTE panel);
+void runDisplayAllPanelsCommand(void);
+void runSetRefreshModeCommand(UBYTE mode);
+void runStatusCommand(void);
+void runSetWaveformCommand(UBYTE profile);
+void receiveNextDrawListByte(UBYTE msg);
+void runDrawListCommand(void);
+void receiveNextDitherByte(UBYTE msg);
+void startDither(void);
+void receiveDitherPixel(UBYTE gray);
+void runSelectLayerCommand(UBYTE layer);
+void receiveNextComposeByte(UBYTE msg);
+void runComposeLayersCommand(void);
+void runRotateImageCommand(UBYTE quarterTurns);
+EPD_7IN5_V2_MODE initPanelForRefresh(EPD_7IN5_V2_MODE requestedMode);
+void initPanelMode(EPD_7IN5_V2_MODE mode);
+void displayPanelImage(EPD_7IN5_V2_MODE mode, UBYTE *image);
+void markPanelChanged(UBYTE panel);
 void resetByteMsgRx(void);
 void startByteMsgRx(void);
 void resetByteMsgRx(void);
@@ -143,12 +263,32 @@ void getPicoSerialNumber(char* idChars) {
 
 
 int buildIdentString(char* targetString, int length, char* serial){
+
+    char temperatureString[5] = "null";
+    if(panelTemperatures[EPD_Panel_Active] != PANEL_TEMPERATURE_UNKNOWN){
+        snprintf(temperatureString, 5, "%d", panelTemperatures[EPD_Panel_Active]);
+    }
+
+    // Waveform profile names, the index is the CMD_SET_WAVEFORM argument
+    char waveformsString[128] = "";
+    int waveformsLength = 0;
+    for(UBYTE i = 0; i < EPD_7IN5_V2_Lut_Count; i++){
+        waveformsLength += snprintf(waveformsString + waveformsLength, sizeof(waveformsString) - waveformsLength,
+            "%s\"%s\"", (i == 0)? "": ",", EPD_7IN5_V2_Luts[i].Name);
+        if(waveformsLength >= (int)sizeof(waveformsString)){
+            waveformsString[0] = '\0';
+            break;
+        }
+    }
     
     int strLen = snprintf(targetString, length, identString, 
         ident_device, 
         ident_version, 
         serial, 
         ident_board, 
+        EPD_Panel_Count,
+        temperatureString,
+        waveformsString,
         ident_display_type, 
         ident_display_size, 
         ident_display_width, 
@@ -275,6 +415,50 @@ void ProcessByteReceived(UBYTE msg){
             receiveNextImageByte(msg);
             break;
 
+        case RX_FUNCTION_PANEL_SELECT:
+            runSelectPanelCommand(msg);
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+
+        case RX_FUNCTION_REFRESH_MODE:
+            runSetRefreshModeCommand(msg);
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+
+        case RX_FUNCTION_WAVEFORM:
+            runSetWaveformCommand(msg);
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+
+        case RX_FUNCTION_DRAW_LIST_LENGTH:
+        case RX_FUNCTION_DRAW_LIST:
+            receiveNextDrawListByte(msg);
+            break;
+
+        case RX_FUNCTION_DITHER_HEADER:
+        case RX_FUNCTION_DITHER:
+        case RX_FUNCTION_DITHER_OVERRUN:
+            receiveNextDitherByte(msg);
+            break;
+
+        case RX_FUNCTION_LAYER_SELECT:
+            runSelectLayerCommand(msg);
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+
+        case RX_FUNCTION_COMPOSE:
+            receiveNextComposeByte(msg);
+            break;
+
+        case RX_FUNCTION_ROTATE:
+            runRotateImageCommand(msg);
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+
+        case RX_FUNCTION_DISCARD:
+            // A payload of unknown length, ignored until the host sends UART_RESET_CHAR
+            break;
+
         default:
             // Unsupported RxFunctionState 
             printf(ERROR_MESSAGE_START);
@@ -308,6 +492,42 @@ void selectNewRxFuntion(UBYTE msg){
             runDisplaySplashScreenCommand();
             rxFunctionState = RX_FUNCTION_IDLE;
             break;
+        case CMD_SELECT_PANEL:
+            rxFunctionState = RX_FUNCTION_PANEL_SELECT;
+            break;
+        case CMD_IMG_DISPLAY_ALL:
+            runDisplayAllPanelsCommand();
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+        case CMD_SET_REFRESH_MODE:
+            rxFunctionState = RX_FUNCTION_REFRESH_MODE;
+            break;
+        case CMD_STATUS:
+            runStatusCommand();
+            rxFunctionState = RX_FUNCTION_IDLE;
+            break;
+        case CMD_SET_WAVEFORM:
+            rxFunctionState = RX_FUNCTION_WAVEFORM;
+            break;
+        case CMD_DRAW_LIST:
+            drawListLength = 0;
+            drawListRxIndex = 0;
+            rxFunctionState = RX_FUNCTION_DRAW_LIST_LENGTH;
+            break;
+        case CMD_IMG_DITHER:
+            ditherRxIndex = 0;
+            rxFunctionState = RX_FUNCTION_DITHER_HEADER;
+            break;
+        case CMD_SELECT_LAYER:
+            rxFunctionState = RX_FUNCTION_LAYER_SELECT;
+            break;
+        case CMD_COMPOSE_LAYERS:
+            composeRxIndex = 0;
+            rxFunctionState = RX_FUNCTION_COMPOSE;
+            break;
+        case CMD_ROTATE_IMAGE:
+            rxFunctionState = RX_FUNCTION_ROTATE;
+            break;
         default:
             // Unsuppported command
             sendErrorMessage("Unsupported command: 0x%2x");
@@ -335,7 +555,15 @@ void sendErrorMessage(const char* message){
 void receiveNextImageByte(UBYTE msg){
     //printf("BlackImage[%d] = 0x%2x\n", imageRxIndex, msg);
 
-    BlackImage[imageRxIndex] = msg;
+    // Only the bytes that differ make the next partial refresh bigger
+    if(drawTarget->Image[imageRxIndex] != msg){
+        drawTarget->Image[imageRxIndex] = msg;
+        // The pixels of the byte, by the rows and the pixel format of the target's memory
+        UWORD pixelsPerByte = drawTarget->Format->PixelsPerByte;
+        UWORD x = imageRxIndex % drawTarget->WidthByte * pixelsPerByte;
+        UWORD y = imageRxIndex / drawTarget->WidthByte;
+        PaintCtx_MarkDirty(drawTarget, x, y, x + pixelsPerByte, y + 1);
+    }
     imageRxIndex++;
     
     if(imageRxIndex >= ImagesizeInBytes){
@@ -346,9 +574,153 @@ void receiveNextImageByte(UBYTE msg){
 }
 
 
+// The list length comes first, two bytes little endian, then the list
+void receiveNextDrawListByte(UBYTE msg){
+
+    if(rxFunctionState == RX_FUNCTION_DRAW_LIST_LENGTH){
+        drawListLength |= (UDOUBLE)msg << (8 * drawListRxIndex);
+        drawListRxIndex++;
+        if(drawListRxIndex < 2){
+            return;
+        }
+        drawListRxIndex = 0;
+        rxFunctionState = RX_FUNCTION_DRAW_LIST;
+    }
+    else{
+        if(drawListRxIndex < DL_MAX_BYTES){
+            drawList[drawListRxIndex] = msg;
+        }
+        drawListRxIndex++;
+    }
+
+    if(drawListRxIndex >= drawListLength){
+        rxFunctionState = RX_FUNCTION_IDLE;
+        runDrawListCommand();
+    }
+}
+
+
+// The header comes first, then width * height gray bytes, 0 black to 255 white.
+// PackBits compressed, a run starts with n: n + 1 bytes follow when n < 128,
+// the next byte repeats 257 - n times when n > 128, 128 is skipped
+void receiveNextDitherByte(UBYTE msg){
+
+    if(rxFunctionState == RX_FUNCTION_DITHER_HEADER){
+        ditherHeader[ditherRxIndex++] = msg;
+        if(ditherRxIndex == DITHER_HEADER_BYTES){
+            startDither();
+        }
+        return;
+    }
+
+    if(rxFunctionState == RX_FUNCTION_DITHER_OVERRUN){
+        // The rest of a literal run that went past the image, dropped so it does not run as commands
+        ditherRunLeft--;
+        if(ditherRunLeft == 0){
+            rxFunctionState = RX_FUNCTION_IDLE;
+            sendErrorMessage("PackBits run past the end of the image");
+        }
+        return;
+    }
+
+    if(ditherCompression == DITHER_COMPRESSION_NONE){
+        receiveDitherPixel(msg);
+    }
+    else if(ditherRunLeft == 0){
+        if(msg < 128){
+            ditherRunLeft = msg + 1;
+            ditherRunRepeat = false;
+        }
+        else if(msg > 128){
+            ditherRunLeft = 257 - msg;
+            ditherRunRepeat = true;
+        }
+    }
+    else if(ditherRunRepeat){
+        while(ditherRunLeft > 0 && rxFunctionState == RX_FUNCTION_DITHER){
+            ditherRunLeft--;
+            receiveDitherPixel(msg);
+        }
+        ditherRunLeft = 0;
+    }
+    else{
+        ditherRunLeft--;
+        receiveDitherPixel(msg);
+    }
+}
+
+
+void startDither(void){
+
+    UWORD x = ditherHeader[0] | (ditherHeader[1] << 8);
+    UWORD y = ditherHeader[2] | (ditherHeader[3] << 8);
+    UWORD width = ditherHeader[4] | (ditherHeader[5] << 8);
+    UWORD height = ditherHeader[6] | (ditherHeader[7] << 8);
+    UBYTE scale = ditherHeader[8];
+    UBYTE mode = ditherHeader[9];
+
+    ditherCompression = ditherHeader[10];
+    ditherPixelsLeft = (UDOUBLE)width * height;
+    ditherRunLeft = 0;
+    ditherRowIndex = 0;
+    ditherFailure = NULL;
+
+    if(ditherCompression > DITHER_COMPRESSION_PACKBITS){
+        // The length of the pixels is unknown, so none of them may run as commands.
+        // They are dropped until the host resets the protocol
+        sendErrorMessage("Unknown compression, reset the protocol");
+        rxFunctionState = RX_FUNCTION_DISCARD;
+        return;
+    }
+    if(ditherPixelsLeft == 0){
+        ditherFailure = "Empty image";
+    }
+    else if(width > EPD_7IN5_V2_WIDTH || (UDOUBLE)(width - 1) * scale >= EPD_7IN5_V2_WIDTH){
+        ditherFailure = "Dithered image is wider than the panel";
+    }
+    else if(DitherCtx_Start(drawTarget, &dither, x, y, width, height, scale, (DITHER_MODE)mode,
+                            ditherErrors, sizeof(ditherErrors) / sizeof(ditherErrors[0])) != 0){
+        ditherFailure = "Invalid dither mode or scale";
+    }
+
+    rxFunctionState = RX_FUNCTION_DITHER;
+    if(ditherPixelsLeft == 0){
+        rxFunctionState = RX_FUNCTION_IDLE;
+        sendErrorMessage(ditherFailure);
+    }
+}
+
+
+void receiveDitherPixel(UBYTE gray){
+
+    if(ditherFailure == NULL){
+        ditherRow[ditherRowIndex++] = gray;
+        if(ditherRowIndex == dither.Width){
+            Dither_Row(&dither, ditherRow);
+            ditherRowIndex = 0;
+        }
+    }
+
+    ditherPixelsLeft--;
+    if(ditherPixelsLeft == 0){
+        if(ditherRunLeft > 0 && !ditherRunRepeat){
+            rxFunctionState = RX_FUNCTION_DITHER_OVERRUN;
+            return;
+        }
+        rxFunctionState = RX_FUNCTION_IDLE;
+        if(ditherFailure != NULL){
+            sendErrorMessage(ditherFailure);
+        }
+        else{
+            sendAckMessage(ACK_IMAGE_DITHERED_MSG);
+        }
+    }
+}
+
+
 void runIdentCommand(){
 
-    int jsonMaxLength = 256;
+    int jsonMaxLength = 512;
     char identJson[jsonMaxLength];
 
     int written = createIdentJson(identJson, jsonMaxLength);
@@ -370,6 +742,7 @@ void runClearDisplayCommand(void){
     EPD_7IN5_V2_Init();
     EPD_7IN5_V2_Clear();
     EPD_7IN5_V2_Sleep();
+    markPanelChanged(EPD_Panel_Active);
     DEV_Delay_ms(50);
     sendAckMessage(ACK_CLEAR_DISPLAY_MSG);
 }
@@ -382,7 +755,6 @@ void runDisplaySplashScreenCommand(){
 
 
 void showSplashScreen(void){
-    EPD_7IN5_V2_Init();
     Paint_SelectImage(BlackImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
     Paint_Clear(WHITE);
 
@@ -432,23 +804,346 @@ void showSplashScreen(void){
     Paint_DrawRectangle(1, 1, EPD_7IN5_V2_WIDTH-1, EPD_7IN5_V2_HEIGHT-1, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
     Paint_DrawRectangle(5, 5, EPD_7IN5_V2_WIDTH-5, EPD_7IN5_V2_HEIGHT-5, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
 
-    EPD_7IN5_V2_Display(BlackImage);
-    EPD_7IN5_V2_Sleep();
+    // The splash screen goes to every panel, refreshing them at the same time
+    UBYTE activePanel = EPD_Panel_Active;
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        DEV_Select_Panel(panel);
+        EPD_7IN5_V2_Init();
+        EPD_7IN5_V2_Display_Start(BlackImage);
+    }
+    EPD_7IN5_V2_WaitUntilIdle_All((1 << EPD_Panel_Count) - 1);
+
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        DEV_Select_Panel(panel);
+        EPD_7IN5_V2_Sleep();
+    }
+    DEV_Select_Panel(activePanel);
+
+    // The other panels show the splash screen instead of their own image
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        if(panel != activePanel){
+            markPanelChanged(panel);
+        }
+    }
+    Paint_ResetDirty();
+    DEV_Delay_ms(50);
+}
+
+
+void runSelectPanelCommand(UBYTE panel){
+
+    UBYTE previousPanel = EPD_Panel_Active;
+    if(DEV_Select_Panel(panel) != 0){
+        sendErrorMessage("Invalid panel index");
+        return;
+    }
+    Paint_GetDirty(&panelDirty[previousPanel]);
+    BlackImage = PanelImages[panel];
+    Paint_SelectImage(BlackImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_MarkDirty(panelDirty[panel].Xstart, panelDirty[panel].Ystart, panelDirty[panel].Xend, panelDirty[panel].Yend);
+    sendAckMessage(ACK_PANEL_SELECTED_MSG);
+}
+
+
+void runDisplayAllPanelsCommand(void){
+    //printf("Received command to display all panels\n");
+
+    // Load and start every panel first, the refreshes then overlap. Each panel
+    // gets the mode its own temperature allows, a partial refresh only its dirty region
+    UBYTE activePanel = EPD_Panel_Active;
+    UBYTE startedPanels = 0;
+    Paint_GetDirty(&panelDirty[activePanel]);
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        DEV_Select_Panel(panel);
+        EPD_7IN5_V2_MODE mode = initPanelForRefresh(refreshMode);
+        if(mode == EPD_7IN5_V2_MODE_PART){
+            PAINT_RECT *dirty = &panelDirty[panel];
+            if(EPD_7IN5_V2_Display_Window_Start(PanelImages[panel], dirty->Xstart, dirty->Ystart, dirty->Xend, dirty->Yend)){
+                startedPanels |= 1 << panel;
+            }
+        }
+        else{
+            EPD_7IN5_V2_Display_Start(PanelImages[panel]);
+            startedPanels |= 1 << panel;
+        }
+    }
+    EPD_7IN5_V2_WaitUntilIdle_All(startedPanels);
+
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        DEV_Select_Panel(panel);
+        EPD_7IN5_V2_Sleep();
+        panelDirty[panel] = (PAINT_RECT){0, 0, 0, 0};
+    }
+    DEV_Select_Panel(activePanel);
+    Paint_ResetDirty();
     DEV_Delay_ms(50);
+    sendAckMessage(ACK_DISPLAY_ALL_PANELS);
+}
+
+
+void runSetRefreshModeCommand(UBYTE mode){
+
+    if(mode != EPD_7IN5_V2_MODE_FULL && mode != EPD_7IN5_V2_MODE_FAST && mode != EPD_7IN5_V2_MODE_PART){
+        sendErrorMessage("Unsupported refresh mode");
+        return;
+    }
+    refreshMode = (EPD_7IN5_V2_MODE)mode;
+    sendAckMessage(ACK_REFRESH_MODE_MSG);
+}
+
+
+void runStatusCommand(void){
+
+    // The panel sleeps between commands, wake it to measure
+    EPD_7IN5_V2_Init();
+    UBYTE status = EPD_7IN5_V2_ReadStatus();
+    int8_t temperature = EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Sleep();
+    panelTemperatures[EPD_Panel_Active] = temperature;
+
+    EPD_7IN5_V2_MODE requestedMode = (waveform != NULL)? waveform->Mode: refreshMode;
+    EPD_7IN5_V2_MODE mode = EPD_7IN5_V2_SelectMode(requestedMode, temperature);
+    bool useWaveform = (waveform != NULL) && (mode == waveform->Mode);
+
+    int jsonMaxLength = 192;
+    char statusJson[jsonMaxLength];
+
+    snprintf(statusJson, jsonMaxLength, statusString,
+        EPD_Panel_Active,
+        temperature,
+        status,
+        refreshModeNames[mode],
+        useWaveform? waveform->Name: "stock",
+        (unsigned long)(useWaveform? EPD_7IN5_V2_Lut_Time_ms(waveform): EPD_7IN5_V2_RefreshTime_ms(mode, temperature)));
+
+    sendAckMessage(statusJson);
+}
+
+
+void runSetWaveformCommand(UBYTE profile){
+
+    if(profile == WAVEFORM_STOCK){
+        waveform = NULL;
+    }
+    else if(profile < EPD_7IN5_V2_Lut_Count){
+        waveform = &EPD_7IN5_V2_Luts[profile];
+    }
+    else{
+        sendErrorMessage("Unknown waveform profile");
+        return;
+    }
+    sendAckMessage(ACK_WAVEFORM_MSG);
+}
+
+
+// Initializes the panel for the requested mode, or a full refresh when it is too cold.
+// A selected waveform profile replaces the requested mode.
+// The mode is chosen on the last known temperature and checked against a fresh reading
+EPD_7IN5_V2_MODE initPanelForRefresh(EPD_7IN5_V2_MODE requestedMode){
+
+    if(waveform != NULL){
+        requestedMode = waveform->Mode;
+    }
+
+    EPD_7IN5_V2_MODE mode = EPD_7IN5_V2_SelectMode(requestedMode, panelTemperatures[EPD_Panel_Active]);
+    initPanelMode(mode);
+
+    panelTemperatures[EPD_Panel_Active] = EPD_7IN5_V2_ReadTemperature();
+
+    EPD_7IN5_V2_MODE measuredMode = EPD_7IN5_V2_SelectMode(requestedMode, panelTemperatures[EPD_Panel_Active]);
+    if(measuredMode != mode){
+        mode = measuredMode;
+        initPanelMode(mode);
+    }
+    return mode;
+}
+
+
+// The waveform profile is only used for its own mode, a fallback uses the stock waveforms
+void initPanelMode(EPD_7IN5_V2_MODE mode){
+
+    if((waveform != NULL) && (mode == waveform->Mode)){
+        EPD_7IN5_V2_Init_Lut(waveform);
+    }
+    else{
+        EPD_7IN5_V2_Init_Mode(mode);
+    }
+}
+
+
+// A partial refresh only sends and refreshes what changed since the last refresh,
+// nothing at all when the image is the same
+void displayPanelImage(EPD_7IN5_V2_MODE mode, UBYTE *image){
+
+    PAINT_RECT dirty;
+
+    if(mode == EPD_7IN5_V2_MODE_PART){
+        if(Paint_GetDirty(&dirty)){
+            EPD_7IN5_V2_Display_Window(image, dirty.Xstart, dirty.Ystart, dirty.Xend, dirty.Yend);
+        }
+    }
+    else{
+        EPD_7IN5_V2_Display(image);
+    }
+    Paint_ResetDirty();
+}
+
+
+// The panel no longer shows its image, the next partial refresh sends all of it
+void markPanelChanged(UBYTE panel){
+
+    if(panel == EPD_Panel_Active){
+        Paint_MarkDirty(0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    }
+    else{
+        panelDirty[panel] = (PAINT_RECT){0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT};
+    }
 }
 
 
 void runDisplayImageCommand(){
     //printf("Received command to display image\n");
 
-    EPD_7IN5_V2_Init();
-    EPD_7IN5_V2_Display(BlackImage);
+    EPD_7IN5_V2_MODE mode = initPanelForRefresh(refreshMode);
+    displayPanelImage(mode, BlackImage);
     EPD_7IN5_V2_Sleep();
     DEV_Delay_ms(50);
     sendAckMessage(ACK_DISPLAY_IMG_BUFFER);
 }
 
 
+// Draws the received display list into the image buffer of the selected panel and displays it.
+// A partial refresh only sends what the list changed. A list drawn into a layer is not displayed
+void runDrawListCommand(void){
+
+    if(drawListLength > DL_MAX_BYTES){
+        sendErrorMessage("Display list too long");
+        return;
+    }
+
+    const char* error = displayList_render(drawTarget, drawList, drawListLength);
+    if(error != NULL){
+        sendErrorMessage(error);
+        return;
+    }
+    if(drawTarget != &Paint){
+        sendAckMessage(ACK_DRAW_LIST_MSG);
+        return;
+    }
+
+    EPD_7IN5_V2_MODE mode = initPanelForRefresh(refreshMode);
+    displayPanelImage(mode, BlackImage);
+    EPD_7IN5_V2_Sleep();
+    DEV_Delay_ms(50);
+    sendAckMessage(ACK_DRAW_LIST_MSG);
+}
+
+
+// Following images, dithered images and display lists draw into the layer,
+// or into the image buffer of the selected panel for LAYER_FRAME
+void runSelectLayerCommand(UBYTE layer){
+
+    if(layer == LAYER_FRAME){
+        drawTarget = &Paint;
+    }
+    else if(layer >= LAYER_COUNT){
+        sendErrorMessage("Invalid layer index");
+        return;
+    }
+    else{
+        if(layers[layer].Image == NULL){
+            UBYTE *image = (UBYTE *)malloc(ImagesizeInBytes);
+            if(image == NULL){
+                sendErrorMessage("Not enough memory for the layer");
+                return;
+            }
+            memset(image, WHITE, ImagesizeInBytes);
+            PaintCtx_NewImage(&layers[layer], image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+        }
+        drawTarget = &layers[layer];
+    }
+    sendAckMessage(ACK_LAYER_SELECTED_MSG);
+}
+
+
+void receiveNextComposeByte(UBYTE msg){
+
+    if(composeRxIndex < sizeof(composeArgs)){
+        composeArgs[composeRxIndex] = msg;
+    }
+    composeRxIndex++;
+
+    if(composeRxIndex == 1 + 2 * (UDOUBLE)composeArgs[0]){
+        rxFunctionState = RX_FUNCTION_IDLE;
+        runComposeLayersCommand();
+    }
+}
+
+
+// Combines the layers into the image buffer of the selected panel, in the order they were sent,
+// and displays it. A partial refresh only sends the bytes whose composition changed
+void runComposeLayersCommand(void){
+
+    PAINT_LAYER composition[LAYER_COUNT];
+    UBYTE count = composeArgs[0];
+
+    if(count == 0 || count > LAYER_COUNT){
+        sendErrorMessage("Invalid layer count");
+        return;
+    }
+    for(UBYTE i = 0; i < count; i++){
+        UBYTE layer = composeArgs[1 + 2 * i];
+        UBYTE rop = composeArgs[2 + 2 * i];
+        if(layer >= LAYER_COUNT || layers[layer].Image == NULL){
+            sendErrorMessage("Composed layer was never selected");
+            return;
+        }
+        if(rop > BLIT_NOT){
+            sendErrorMessage("Unknown raster op");
+            return;
+        }
+        composition[i] = (PAINT_LAYER){&layers[layer], (BLIT_ROP)rop};
+    }
+    Paint_Compose(composition, count);
+
+    EPD_7IN5_V2_MODE mode = initPanelForRefresh(refreshMode);
+    displayPanelImage(mode, BlackImage);
+    EPD_7IN5_V2_Sleep();
+    DEV_Delay_ms(50);
+    sendAckMessage(ACK_LAYERS_COMPOSED_MSG);
+}
+
+
+// The draw target holds an image for a panel mounted quarterTurns * 90 degrees clockwise, packed
+// row by row in its own orientation, so 480 x 800 for one or three turns. Turns it into the layout
+// of the panel. The rotated image is composed back, so only the bytes that changed are marked dirty
+void runRotateImageCommand(UBYTE quarterTurns){
+
+    if(quarterTurns > 3){
+        sendErrorMessage("Invalid rotation");
+        return;
+    }
+    if(rotatedImage.Image == NULL){
+        UBYTE *image = (UBYTE *)malloc(ImagesizeInBytes);
+        if(image == NULL){
+            sendErrorMessage("Not enough memory to rotate");
+            return;
+        }
+        PaintCtx_NewImage(&rotatedImage, image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+    }
+
+    bool portrait = (quarterTurns & 1) != 0;
+    Paint_RotateImage(drawTarget->Image,
+                      portrait? EPD_7IN5_V2_HEIGHT: EPD_7IN5_V2_WIDTH,
+                      portrait? EPD_7IN5_V2_WIDTH: EPD_7IN5_V2_HEIGHT,
+                      rotatedImage.Image, quarterTurns * 90);
+
+    PAINT_LAYER layer = {&rotatedImage, BLIT_COPY};
+    PaintCtx_Compose(drawTarget, &layer, 1);
+    sendAckMessage(ACK_IMAGE_ROTATED_MSG);
+}
+
+
 void initialize(void){
     //printf("EPD_7IN5_V2_test Demo\r\n");
     if(DEV_Module_Init()!=0){
@@ -456,11 +1151,21 @@ void initialize(void){
     }
 
     ImagesizeInBytes = ((EPD_7IN5_V2_WIDTH % 8 == 0)? (EPD_7IN5_V2_WIDTH / 8 ): (EPD_7IN5_V2_WIDTH / 8 + 1)) * EPD_7IN5_V2_HEIGHT;
-    if((BlackImage = (UBYTE *)malloc(ImagesizeInBytes)) == NULL) {
-        printf("Failed to apply for black memory...\r\n");
-        return;
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        if((PanelImages[panel] = (UBYTE *)malloc(ImagesizeInBytes)) == NULL) {
+            printf("Failed to apply for black memory...\r\n");
+            return;
         }
+        memset(PanelImages[panel], WHITE, ImagesizeInBytes);
+    }
+    BlackImage = PanelImages[0];
+    for(UBYTE panel = 0; panel < EPD_MAX_PANELS; panel++){
+        panelTemperatures[panel] = PANEL_TEMPERATURE_UNKNOWN;
+    }
     Paint_NewImage(BlackImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);     
+    for(UBYTE panel = 0; panel < EPD_Panel_Count; panel++){
+        markPanelChanged(panel);
+    }
     messageByteString[2] = 0;
 }
 
@@ -0,0 +1,589 @@
+/*****************************************************************************
+* | File      	:   DEV_Config_sim.c
+* | Function    :   Host simulation of the hardware interface
+* | Info        :
+*   Replaces lib/Config/DEV_Config.c in the host build (PICOPAPER_HOST_SIM).
+*   The panels are modelled as UC8179 controllers, see DEV_Sim.h.
+*   Only what the drivers in lib/e-paper use is decoded: the register
+*   writes, RAM planes 0x10/0x13, partial window 0x90/0x91/0x92, refresh
+*   0x12, power 0x04/0x02, deep sleep 0x07 and the reads 0x40 and 0x71.
+******************************************************************************/
+#include "DEV_Sim.h"
+#include <string.h>
+
+#define SIM_POWER_ON_MS     40
+#define SIM_POWER_OFF_MS    20
+#define SIM_TSC_MS          10
+#define SIM_DEFAULT_TEMP    25
+
+#define SIM_REG_DATA        8       // Data bytes kept per register
+#define SIM_LUT_DATA        60
+
+/**
+ * GPIO
+**/
+int EPD_CLK_PIN;
+int EPD_MOSI_PIN;
+
+/**
+ * Panel pins: RST, DC, CS, BUSY, the same as DEV_Config.c
+**/
+EPD_PANEL EPD_Panels[EPD_MAX_PANELS] = {
+    {12,  8,  9, 13},
+    { 7,  6,  5,  4},
+    { 3,  2,  1,  0},
+    {18, 16, 17, 19},
+};
+UBYTE EPD_Panel_Count;
+UBYTE EPD_Panel_Active;
+
+DEV_SIM_COUNTERS DEV_Sim_Counters;
+
+/**
+ * Controller state that is not visible through DEV_SIM_PANEL
+**/
+typedef struct {
+    UBYTE Cs;                       // Pin levels
+    UBYTE Dc;
+    UBYTE Rst;
+    UBYTE Command;                  // Last command and its data count
+    UWORD DataCount;
+    UBYTE Reg[256][SIM_REG_DATA];
+    UBYTE Lut[5][SIM_LUT_DATA];
+    UWORD RamX, RamY;               // RAM write pointer, X in bytes
+    UBYTE Read[2];                  // Data returned by the last read command
+    UBYTE ReadCount;
+} SIM_CONTROLLER;
+
+static DEV_SIM_PANEL Sim_Panels[EPD_MAX_PANELS];
+static SIM_CONTROLLER Sim_Controllers[EPD_MAX_PANELS];
+static UBYTE Sim_Ready;
+
+/******************************************************************************
+function:	Advance the simulated clock
+******************************************************************************/
+static void Sim_Spi_Time(UDOUBLE Bytes)
+{
+    uint64_t ns = (uint64_t)Bytes * 8 * 1000000000ull / DEV_SIM_SPI_HZ + DEV_SIM_SPI_CALL_NS;
+    DEV_Sim_Counters.Spi_ns += ns;
+    DEV_Sim_Counters.Time_ns += ns;
+}
+
+static void Sim_Busy(UBYTE Panel, UDOUBLE ms)
+{
+    Sim_Panels[Panel].BusyUntil_ns = DEV_Sim_Counters.Time_ns + (uint64_t)ms * 1000000ull;
+}
+
+/******************************************************************************
+function:	Controller reset, the RAM and the shown image are kept
+******************************************************************************/
+static void Sim_Reset_Controller(UBYTE Panel)
+{
+    DEV_SIM_PANEL *p = &Sim_Panels[Panel];
+    SIM_CONTROLLER *c = &Sim_Controllers[Panel];
+
+    memset(c->Reg, 0, sizeof(c->Reg));
+    memset(c->Lut, 0, sizeof(c->Lut));
+    c->Reg[0x50][0] = 0x31;         // Power on defaults that the drivers rely on
+    c->Reg[0x50][1] = 0x07;
+    c->Reg[0x61][0] = DEV_SIM_WIDTH >> 8;
+    c->Reg[0x61][1] = DEV_SIM_WIDTH & 0xFF;
+    c->Reg[0x61][2] = DEV_SIM_HEIGHT >> 8;
+    c->Reg[0x61][3] = DEV_SIM_HEIGHT & 0xFF;
+    c->Reg[0x30][0] = 0x06;
+    c->Command = 0;
+    c->DataCount = 0;
+    c->ReadCount = 0;
+
+    p->Powered = 0;
+    p->Sleeping = 0;
+    p->Partial = 0;
+    p->BusyUntil_ns = DEV_Sim_Counters.Time_ns;
+}
+
+/******************************************************************************
+function:	The RAM window that 0x10/0x13 write to and 0x12 refreshes
+parameter:
+    Xs, Xe : First and last byte column
+    Ys, Ye : First and last row
+******************************************************************************/
+static void Sim_Window(UBYTE Panel, UWORD *Xs, UWORD *Xe, UWORD *Ys, UWORD *Ye)
+{
+    SIM_CONTROLLER *c = &Sim_Controllers[Panel];
+    const UBYTE *r;
+    UWORD Width = ((c->Reg[0x61][0] & 0x03) << 8 | c->Reg[0x61][1]) / 8;
+    UWORD Height = (c->Reg[0x61][2] & 0x03) << 8 | c->Reg[0x61][3];
+
+    if(Width == 0 || Width > DEV_SIM_WIDTH / 8)
+        Width = DEV_SIM_WIDTH / 8;
+    if(Height == 0 || Height > DEV_SIM_HEIGHT)
+        Height = DEV_SIM_HEIGHT;
+
+    *Xs = 0;
+    *Xe = Width - 1;
+    *Ys = 0;
+    *Ye = Height - 1;
+    if(!Sim_Panels[Panel].Partial)
+        return;
+
+    r = c->Reg[0x90];
+    *Xs = ((r[0] & 0x03) << 8 | r[1]) >> 3;
+    *Xe = ((r[2] & 0x03) << 8 | r[3]) >> 3;
+    *Ys = (r[4] & 0x03) << 8 | r[5];
+    *Ye = (r[6] & 0x03) << 8 | r[7];
+    if(*Xe >= Width)
+        *Xe = Width - 1;
+    if(*Ye >= Height)
+        *Ye = Height - 1;
+}
+
+/******************************************************************************
+function:	Frame rate of the PLL setting (0x30)
+******************************************************************************/
+static UDOUBLE Sim_Frame_Hz(UBYTE Pll)
+{
+    static const UBYTE Rates[16] = {
+        50, 5, 10, 15, 20, 30, 50, 60, 70, 80, 90, 100, 120, 150, 180, 200,
+    };
+    return Rates[Pll & 0x0F];
+}
+
+/******************************************************************************
+function:	How long a refresh keeps BUSY low
+info:
+    With the LUT from registers the VCOM LUT gives the frame count, so the
+    time follows from what the driver sent. The OTP waveforms are not
+    known, the forced temperature (0xE5) only picks one of the typical
+    times of the panel, whatever the panel temperature. Those runs show
+    the SPI traffic, their refresh time does not check the driver's
+    EPD_7IN5_V2_RefreshTime_ms estimate
+******************************************************************************/
+static UDOUBLE Sim_Refresh_ms(UBYTE Panel)
+{
+    SIM_CONTROLLER *c = &Sim_Controllers[Panel];
+    UDOUBLE Frames = 0;
+    UBYTE i;
+
+    if(c->Reg[0x00][0] & 0x20) {
+        for(i = 0; i + 6 <= SIM_LUT_DATA; i += 6) {
+            Frames += (UDOUBLE)(c->Lut[0][i + 1] + c->Lut[0][i + 2] + c->Lut[0][i + 3] + c->Lut[0][i + 4]) * c->Lut[0][i + 5];
+        }
+        return Frames * 1000 / Sim_Frame_Hz(c->Reg[0x30][0]);
+    }
+
+    switch((c->Reg[0xE0][0] & 0x02)? c->Reg[0xE5][0]: 0) {
+    case 0x5A:
+        return 1500;
+    case 0x6E:
+        return 400;
+    case 0x5F:
+        return 4500;
+    default:
+        return 5000;
+    }
+}
+
+/******************************************************************************
+function:	Display refresh, decodes the RAM planes into the shown image
+info:
+    The 4 gray waveform (forced temperature 0x5F) uses both planes, old
+    and new set is black. Black and white only uses the new plane, its
+    polarity is DDX[0] of the VCOM and data interval setting (0x50)
+******************************************************************************/
+static void Sim_Refresh(UBYTE Panel)
+{
+    DEV_SIM_PANEL *p = &Sim_Panels[Panel];
+    SIM_CONTROLLER *c = &Sim_Controllers[Panel];
+    UBYTE Gray = !(c->Reg[0x00][0] & 0x20) && (c->Reg[0xE0][0] & 0x02) && c->Reg[0xE5][0] == 0x5F;
+    UBYTE Ddx = (c->Reg[0x50][0] >> 4) & 0x01;
+    UWORD Xs, Xe, Ys, Ye, X, Y;
+    UDOUBLE Addr;
+    UBYTE Bit, Old, New;
+
+    Sim_Window(Panel, &Xs, &Xe, &Ys, &Ye);
+    for(Y = Ys; Y <= Ye; Y++) {
+        for(X = Xs * 8; X < (Xe + 1) * 8; X++) {
+            Addr = X / 8 + (UDOUBLE)Y * (DEV_SIM_WIDTH / 8);
+            Bit = 0x80 >> (X % 8);
+            Old = (p->Plane[DEV_SIM_PLANE_OLD][Addr] & Bit)? 1: 0;
+            New = (p->Plane[DEV_SIM_PLANE_NEW][Addr] & Bit)? 1: 0;
+            if(Gray)
+                p->Screen[Y][X] = 3 - (Old + 2 * New);
+            else
+                p->Screen[Y][X] = (New ^ Ddx)? 3: 0;
+        }
+    }
+
+    p->LastRefresh_ms = Sim_Refresh_ms(Panel);
+    p->Refreshes++;
+    DEV_Sim_Counters.Refreshes++;
+    Sim_Busy(Panel, p->LastRefresh_ms);
+}
+
+/******************************************************************************
+function:	A command byte (DC low)
+******************************************************************************/
+static void Sim_Command(UBYTE Panel, UBYTE Command)
+{
+    DEV_SIM_PANEL *p = &Sim_Panels[Panel];
+    SIM_CONTROLLER *c = &Sim_Controllers[Panel];
+    UWORD Xs, Xe, Ys, Ye;
+
+    DEV_Sim_Counters.Commands++;
+    if(p->Sleeping)
+        return;
+
+    c->Command = Command;
+    c->DataCount = 0;
+    c->ReadCount = 0;
+
+    switch(Command) {
+    case 0x02:          //POWER OFF
+        p->Powered = 0;
+        Sim_Busy(Panel, SIM_POWER_OFF_MS);
+        break;
+    case 0x04:          //POWER ON
+        p->Powered = 1;
+        Sim_Busy(Panel, SIM_POWER_ON_MS);
+        break;
+    case 0x10:          //DATA START TRANSMISSION 1
+    case 0x13:          //DATA START TRANSMISSION 2
+        Sim_Window(Panel, &Xs, &Xe, &Ys, &Ye);
+        c->RamX = Xs;
+        c->RamY = Ys;
+        break;
+    case 0x12:          //DISPLAY REFRESH
+        Sim_Refresh(Panel);
+        break;
+    case 0x40:          //TEMPERATURE SENSOR
+        c->Read[0] = (UBYTE)p->Temperature;
+        c->Read[1] = 0;
+        Sim_Busy(Panel, SIM_TSC_MS);
+        break;
+    case 0x71:          //GET STATUS
+        c->Read[0] = ((DEV_Sim_Counters.Time_ns >= p->BusyUntil_ns)? 0x01: 0) |
+                     (p->Powered? 0x04: 0x02) | (p->Partial? 0x40: 0);
+        break;
+    case 0x91:          //PARTIAL IN
+        p->Partial = 1;
+        break;
+    case 0x92:          //PARTIAL OUT
+        p->Partial = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function:	A data byte (DC high)
+******************************************************************************/
+static void Sim_Data(UBYTE Panel, UBYTE Data)
+{
+    DEV_SIM_PANEL *p = &Sim_Panels[Panel];
+    SIM_CONTROLLER *c = &Sim_Controllers[Panel];
+    UWORD Xs, Xe, Ys, Ye;
+
+    if(p->Sleeping)
+        return;
+
+    switch(c->Command) {
+    case 0x10:
+    case 0x13:
+        Sim_Window(Panel, &Xs, &Xe, &Ys, &Ye);
+        if(c->RamY <= Ye) {
+            p->Plane[(c->Command == 0x10)? DEV_SIM_PLANE_OLD: DEV_SIM_PLANE_NEW]
+                    [c->RamX + (UDOUBLE)c->RamY * (DEV_SIM_WIDTH / 8)] = Data;
+            if(++c->RamX > Xe) {
+                c->RamX = Xs;
+                c->RamY++;
+            }
+        }
+        break;
+    case 0x20:
+    case 0x21:
+    case 0x22:
+    case 0x23:
+    case 0x24:
+        if(c->DataCount < SIM_LUT_DATA)
+            c->Lut[c->Command - 0x20][c->DataCount] = Data;
+        break;
+    case 0x07:          //DEEP SLEEP
+        if(Data == 0xA5)
+            p->Sleeping = 1;
+        break;
+    default:
+        if(c->DataCount < SIM_REG_DATA)
+            c->Reg[c->Command][c->DataCount] = Data;
+        break;
+    }
+    c->DataCount++;
+}
+
+/******************************************************************************
+function:	A byte on the bus goes to every panel whose CS is low
+******************************************************************************/
+static void Sim_Byte(UBYTE Data)
+{
+    UBYTE i;
+    for(i = 0; i < EPD_Panel_Count; i++) {
+        if(Sim_Controllers[i].Cs)
+            continue;
+        if(Sim_Controllers[i].Dc)
+            Sim_Data(i, Data);
+        else
+            Sim_Command(i, Data);
+    }
+}
+
+/**
+ * GPIO read and write
+**/
+void DEV_Digital_Write(UWORD Pin, UBYTE Value)
+{
+    UBYTE i;
+
+    DEV_Sim_Counters.GpioWrites++;
+    for(i = 0; i < EPD_Panel_Count; i++) {
+        SIM_CONTROLLER *c = &Sim_Controllers[i];
+        if(Pin == EPD_Panels[i].CS_PIN) {
+            if(c->Cs && !Value)
+                DEV_Sim_Counters.CsToggles++;
+            c->Cs = Value;
+        } else if(Pin == EPD_Panels[i].DC_PIN) {
+            c->Dc = Value;
+        } else if(Pin == EPD_Panels[i].RST_PIN) {
+            if(c->Rst && !Value)
+                Sim_Reset_Controller(i);
+            c->Rst = Value;
+        }
+    }
+}
+
+UBYTE DEV_Digital_Read(UWORD Pin)
+{
+    UBYTE i;
+
+    DEV_Sim_Counters.GpioReads++;
+    for(i = 0; i < EPD_Panel_Count; i++) {
+        if(Pin == EPD_Panels[i].BUSY_PIN)
+            return DEV_Sim_Counters.Time_ns >= Sim_Panels[i].BusyUntil_ns;
+    }
+    return 0;
+}
+
+/**
+ * SPI
+**/
+void DEV_SPI_WriteByte(uint8_t Value)
+{
+    DEV_Sim_Counters.SpiCalls++;
+    DEV_Sim_Counters.SpiBytes++;
+    Sim_Spi_Time(1);
+    Sim_Byte(Value);
+}
+
+void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
+{
+    uint32_t i;
+
+    DEV_Sim_Counters.SpiCalls++;
+    DEV_Sim_Counters.SpiBytes += Len;
+    Sim_Spi_Time(Len);
+    for(i = 0; i < Len; i++)
+        Sim_Byte(pData[i]);
+}
+
+/**
+ * delay x ms
+**/
+void DEV_Delay_ms(UDOUBLE xms)
+{
+    DEV_Sim_Counters.Delay_ns += (uint64_t)xms * 1000000ull;
+    DEV_Sim_Counters.Time_ns += (uint64_t)xms * 1000000ull;
+}
+
+void DEV_GPIO_Init(void)
+{
+    UBYTE i;
+
+    EPD_CLK_PIN     = 10;
+    EPD_MOSI_PIN    = 11;
+
+    EPD_Panel_Count = (EPD_PANEL_COUNT > EPD_MAX_PANELS)? EPD_MAX_PANELS: EPD_PANEL_COUNT;
+    for(i = 0; i < EPD_Panel_Count; i++) {
+        Sim_Controllers[i].Cs = 1;
+        Sim_Controllers[i].Rst = 1;
+    }
+    EPD_Panel_Active = 0;
+}
+
+/******************************************************************************
+function:	Select the panel that the EPD_*_PIN pins refer to
+parameter:
+	Panel : Panel index, 0 .. EPD_Panel_Count-1
+Info:
+	Returns 1 if the panel does not exist, the selection is unchanged then
+******************************************************************************/
+UBYTE DEV_Select_Panel(UBYTE Panel)
+{
+    if(Panel >= EPD_Panel_Count) {
+        return 1;
+    }
+    EPD_Panel_Active = Panel;
+    return 0;
+}
+
+/******************************************************************************
+function:	Module Initialize, the simulated panels keep their state
+parameter:
+Info:
+******************************************************************************/
+UBYTE DEV_Module_Init(void)
+{
+    if(!Sim_Ready)
+        DEV_Sim_Reset();
+    DEV_GPIO_Init();
+    return 0;
+}
+
+void DEV_GPIO_Init_1(void)
+{
+}
+
+void DEV_SPI_Init(void)
+{
+}
+
+/******************************************************************************
+function:	Bit-banged transfers of the read path
+info:
+    Counted with the GPIO accesses that DEV_Config.c makes for them
+******************************************************************************/
+void DEV_SPI_SendData(UBYTE Reg)
+{
+    SIM_CONTROLLER *c = &Sim_Controllers[EPD_Panel_Active];
+
+    DEV_Sim_Counters.SpiCalls++;
+    DEV_Sim_Counters.SpiBytes++;
+    DEV_Sim_Counters.CsToggles++;
+    DEV_Sim_Counters.GpioWrites += 27;
+    Sim_Spi_Time(1);
+
+    if(c->Dc)
+        Sim_Data(EPD_Panel_Active, Reg);
+    else
+        Sim_Command(EPD_Panel_Active, Reg);
+}
+
+UBYTE DEV_SPI_ReadData(void)
+{
+    SIM_CONTROLLER *c = &Sim_Controllers[EPD_Panel_Active];
+    UBYTE Data = 0xFF;
+
+    DEV_Sim_Counters.SpiCalls++;
+    DEV_Sim_Counters.SpiBytes++;
+    DEV_Sim_Counters.CsToggles++;
+    DEV_Sim_Counters.GpioWrites += 19;
+    DEV_Sim_Counters.GpioReads += 8;
+    Sim_Spi_Time(1);
+
+    if(!Sim_Panels[EPD_Panel_Active].Sleeping && c->ReadCount < sizeof(c->Read))
+        Data = c->Read[c->ReadCount++];
+    return Data;
+}
+
+/******************************************************************************
+function:	Module exits
+parameter:
+Info:
+******************************************************************************/
+void DEV_Module_Exit(void)
+{
+
+}
+
+/******************************************************************************
+function:	Power up every simulated panel: white screen, room temperature,
+            counters and clock at zero
+******************************************************************************/
+void DEV_Sim_Reset(void)
+{
+    UBYTE i;
+
+    memset(Sim_Panels, 0, sizeof(Sim_Panels));
+    memset(Sim_Controllers, 0, sizeof(Sim_Controllers));
+    DEV_Sim_Reset_Counters();
+    for(i = 0; i < EPD_MAX_PANELS; i++) {
+        Sim_Reset_Controller(i);
+        Sim_Controllers[i].Cs = 1;
+        Sim_Controllers[i].Rst = 1;
+        Sim_Panels[i].Temperature = SIM_DEFAULT_TEMP;
+        memset(Sim_Panels[i].Screen, 3, sizeof(Sim_Panels[i].Screen));
+    }
+    Sim_Ready = 1;
+}
+
+/******************************************************************************
+function:	Zero the counters and the clock, the panels keep their state
+******************************************************************************/
+void DEV_Sim_Reset_Counters(void)
+{
+    uint64_t Now = DEV_Sim_Counters.Time_ns;
+    UBYTE i;
+
+    memset(&DEV_Sim_Counters, 0, sizeof(DEV_Sim_Counters));
+    for(i = 0; i < EPD_MAX_PANELS; i++) {
+        Sim_Panels[i].BusyUntil_ns = (Sim_Panels[i].BusyUntil_ns > Now)? Sim_Panels[i].BusyUntil_ns - Now: 0;
+    }
+}
+
+const DEV_SIM_PANEL *DEV_Sim_Panel(UBYTE Panel)
+{
+    if(!Sim_Ready)
+        DEV_Sim_Reset();
+    return (Panel < EPD_MAX_PANELS)? &Sim_Panels[Panel]: NULL;
+}
+
+void DEV_Sim_Set_Temperature(UBYTE Panel, int8_t Temperature)
+{
+    if(!Sim_Ready)
+        DEV_Sim_Reset();
+    if(Panel < EPD_MAX_PANELS)
+        Sim_Panels[Panel].Temperature = Temperature;
+}
+
+void pico_get_unique_board_id(pico_unique_board_id_t *Id)
+{
+    UBYTE i;
+
+    for(i = 0; i < sizeof(Id->id); i++)
+        Id->id[i] = i;
+}
+
+/******************************************************************************
+function:	Write the shown image of a panel as a binary PGM
+parameter:
+    Panel : Panel index
+    Path  : File name
+Info:
+    Returns 0 on success
+******************************************************************************/
+int DEV_Sim_Save_PGM(UBYTE Panel, const char *Path)
+{
+    static const UBYTE Levels[4] = {0x00, 0x55, 0xAA, 0xFF};
+    UBYTE Row[DEV_SIM_WIDTH];
+    UWORD X, Y;
+    FILE *f;
+
+    if(Panel >= EPD_MAX_PANELS || (f = fopen(Path, "wb")) == NULL)
+        return 1;
+
+    fprintf(f, "P5\n%d %d\n255\n", DEV_SIM_WIDTH, DEV_SIM_HEIGHT);
+    for(Y = 0; Y < DEV_SIM_HEIGHT; Y++) {
+        for(X = 0; X < DEV_SIM_WIDTH; X++)
+            Row[X] = Levels[Sim_Panels[Panel].Screen[Y][X] & 0x03];
+        fwrite(Row, 1, DEV_SIM_WIDTH, f);
+    }
+    return fclose(f);
+}
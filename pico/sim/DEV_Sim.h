@@ -0,0 +1,75 @@
+/*****************************************************************************
+* | File      	:   DEV_Sim.h
+* | Function    :   Host simulation of the hardware interface
+* | Info        :
+*   DEV_Config_sim.c implements the DEV_Config.h API on a plain host. Every
+*   GPIO and SPI transaction is counted and the byte stream of each panel is
+*   decoded like a UC8179 controller does it: register writes, the two RAM
+*   planes (0x10 old, 0x13 new), the partial window and the refresh.
+*   BUSY follows a timing model, so the driver waits like on the panel while
+*   the simulated clock runs instead of the real one.
+******************************************************************************/
+#ifndef _DEV_SIM_H_
+#define _DEV_SIM_H_
+
+#include "DEV_Config.h"
+
+#define DEV_SIM_WIDTH       800
+#define DEV_SIM_HEIGHT      480
+#define DEV_SIM_PLANE_SIZE  (DEV_SIM_WIDTH / 8 * DEV_SIM_HEIGHT)
+
+#define DEV_SIM_SPI_HZ          4000000     // spi_init() rate of DEV_Config.c
+#define DEV_SIM_SPI_CALL_NS     1000        // Fixed cost of one SPI call
+
+#define DEV_SIM_PLANE_OLD   0
+#define DEV_SIM_PLANE_NEW   1
+
+/**
+ * Counters, all panels together
+**/
+typedef struct {
+    uint64_t Time_ns;       // Simulated wall time
+    uint64_t Delay_ns;      // Part of it spent in DEV_Delay_ms
+    uint64_t Spi_ns;        // Part of it spent on the SPI bus
+    UDOUBLE SpiBytes;       // Bytes clocked out or in
+    UDOUBLE SpiCalls;       // DEV_SPI_* calls
+    UDOUBLE CsToggles;      // Falling edges on a CS pin
+    UDOUBLE GpioWrites;
+    UDOUBLE GpioReads;
+    UDOUBLE Commands;       // Bytes written with DC low
+    UDOUBLE Refreshes;      // 0x12 commands
+} DEV_SIM_COUNTERS;
+
+extern DEV_SIM_COUNTERS DEV_Sim_Counters;
+
+/**
+ * State of one simulated panel
+**/
+typedef struct {
+    int8_t Temperature;         // Reported by 0x40
+    UBYTE Powered;
+    UBYTE Sleeping;             // Deep sleep, ignores everything until a reset
+    UBYTE Partial;              // 0x91 partial mode
+    uint64_t BusyUntil_ns;
+    UDOUBLE Refreshes;
+    UDOUBLE LastRefresh_ms;     // Duration of the last refresh
+    UBYTE Plane[2][DEV_SIM_PLANE_SIZE];             // Controller RAM, old and new
+    UBYTE Screen[DEV_SIM_HEIGHT][DEV_SIM_WIDTH];    // Shown image, 0 black .. 3 white
+} DEV_SIM_PANEL;
+
+/**
+ * Stand-in of pico/unique_id.h for picoDisplay.c, the id is 00 01 .. 07
+**/
+typedef struct {
+    UBYTE id[8];
+} pico_unique_board_id_t;
+
+void pico_get_unique_board_id(pico_unique_board_id_t *Id);
+
+void DEV_Sim_Reset(void);
+void DEV_Sim_Reset_Counters(void);
+const DEV_SIM_PANEL *DEV_Sim_Panel(UBYTE Panel);
+void DEV_Sim_Set_Temperature(UBYTE Panel, int8_t Temperature);
+int DEV_Sim_Save_PGM(UBYTE Panel, const char *Path);
+
+#endif
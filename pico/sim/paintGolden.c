@@ -0,0 +1,551 @@
+/*****************************************************************************
+* | File      	:   paintGolden.c
+* | Function    :   Checksum tests of the GUI drawing paths
+* | Info        :
+*   Draws fixed scenes with the span rasterizers, the clip stack, every
+*   font, the dither, blit, compose and rotate paths and the barcodes, and
+*   compares a CRC-32 of the image memory with the checksum recorded when
+*   the scene was last reviewed. A changed checksum is not always a bug:
+*   write the images with -o, look at them, and record the printed
+*   checksums in Goldens. A few paths are also checked pixel by pixel
+*   against a simple reference, which needs no recorded checksum.
+*
+*   paintGolden [-o DIR]     -o writes the image of every scene as PGM
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "GUI_Dither.h"
+#include "GUI_Barcode.h"
+#include <stdio.h>
+#include <string.h>
+
+#define IMAGE_WIDTH     800
+#define IMAGE_HEIGHT    480
+#define IMAGE_SIZE      (IMAGE_WIDTH / 4 * IMAGE_HEIGHT)    // Big enough for scale 4
+
+static UBYTE Image[IMAGE_SIZE];
+static UBYTE Source[IMAGE_SIZE];
+static UBYTE Reference[IMAGE_SIZE];
+
+/******************************************************************************
+function:	CRC-32 (IEEE 802.3) of a buffer
+******************************************************************************/
+static UDOUBLE Crc32(const UBYTE *Data, UDOUBLE Length)
+{
+    UDOUBLE Crc = 0xFFFFFFFF;
+    UDOUBLE i;
+    UBYTE Bit;
+
+    for(i = 0; i < Length; i++) {
+        Crc ^= Data[i];
+        for(Bit = 0; Bit < 8; Bit++)
+            Crc = (Crc >> 1) ^ (0xEDB88320 & (0 - (Crc & 1)));
+    }
+    return ~Crc;
+}
+
+/******************************************************************************
+function:	Scenes, each drawn into a cleared 800 x 480 image
+******************************************************************************/
+static void Scene_Rectangles(PAINT *Ctx)
+{
+    PaintCtx_FillRect(Ctx, 3, 5, 13, 40, BLACK);
+    PaintCtx_FillRect(Ctx, 17, 5, 95, 40, BLACK);
+    PaintCtx_FillRect(Ctx, 100, 5, 101, 40, BLACK);
+    PaintCtx_ClearWindows(Ctx, 20, 10, 90, 30, WHITE);
+    PaintCtx_DrawRectangle(Ctx, 120, 10, 250, 120, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    PaintCtx_DrawRectangle(Ctx, 130, 20, 240, 110, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawRectangle(Ctx, 150, 40, 220, 90, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawRectangle(Ctx, 270, 10, 420, 200, BLACK, DOT_PIXEL_8X8, DRAW_FILL_EMPTY);
+    PaintCtx_DrawRectangle(Ctx, 780, 460, 900, 900, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
+
+static void Scene_Lines(PAINT *Ctx)
+{
+    UWORD i;
+
+    for(i = 0; i < 8; i++) {
+        PaintCtx_DrawLine(Ctx, 10, 10 + i * 12, 390, 10 + i * 12, BLACK, (DOT_PIXEL)(i + 1), LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(Ctx, 410 + i * 12, 10, 410 + i * 12, 230, BLACK, (DOT_PIXEL)(i + 1), LINE_STYLE_SOLID);
+    }
+    PaintCtx_DrawLine(Ctx, 10, 120, 390, 470, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    PaintCtx_DrawLine(Ctx, 390, 120, 10, 300, BLACK, DOT_PIXEL_3X3, LINE_STYLE_SOLID);
+    PaintCtx_DrawLine(Ctx, 10, 470, 390, 130, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+    PaintCtx_DrawLine(Ctx, 520, 300, 790, 300, BLACK, DOT_PIXEL_2X2, LINE_STYLE_DOTTED);
+    PaintCtx_DrawLine(Ctx, 520, 320, 520, 470, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+    for(i = 0; i < 8; i++) {
+        PaintCtx_DrawPoint(Ctx, 560 + i * 24, 400, BLACK, (DOT_PIXEL)(i + 1), DOT_FILL_AROUND);
+        PaintCtx_DrawPoint(Ctx, 560 + i * 24, 440, BLACK, (DOT_PIXEL)(i + 1), DOT_FILL_RIGHTUP);
+    }
+}
+
+static void Scene_Curves(PAINT *Ctx)
+{
+    PaintCtx_DrawCircle(Ctx, 80, 80, 60, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    PaintCtx_DrawCircle(Ctx, 80, 80, 40, BLACK, DOT_PIXEL_4X4, DRAW_FILL_EMPTY);
+    PaintCtx_DrawCircle(Ctx, 220, 80, 60, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawCircle(Ctx, 790, 10, 50, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawEllipse(Ctx, 420, 80, 110, 40, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    PaintCtx_DrawEllipse(Ctx, 420, 200, 60, 70, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawEllipse(Ctx, 640, 120, 90, 30, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawArc(Ctx, 100, 300, 80, 0, 90, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    PaintCtx_DrawArc(Ctx, 100, 300, 60, 135, 315, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawArc(Ctx, 280, 300, 70, 300, 60, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawRoundedRectangle(Ctx, 380, 300, 560, 460, 20, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    PaintCtx_DrawRoundedRectangle(Ctx, 400, 320, 540, 440, 30, BLACK, DOT_PIXEL_5X5, DRAW_FILL_EMPTY);
+    PaintCtx_DrawRoundedRectangle(Ctx, 580, 300, 790, 460, 50, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
+
+static void Scene_Polygons(PAINT *Ctx)
+{
+    static const PAINT_POINT Star[] = {
+        {100, 10}, {160, 190}, {10, 80}, {190, 80}, {40, 190},
+    };
+    static const PAINT_POINT StarRight[] = {
+        {300, 10}, {360, 190}, {210, 80}, {390, 80}, {240, 190},
+    };
+    static const PAINT_POINT Zigzag[] = {
+        {420, 20}, {480, 180}, {540, 30}, {600, 170}, {660, 40}, {780, 200},
+    };
+    static const PAINT_POINT Shape[] = {
+        {20, 250}, {380, 230}, {300, 470}, {200, 330}, {60, 460},
+    };
+
+    PaintCtx_FillPolygon(Ctx, Star, 5, BLACK, FILL_RULE_EVEN_ODD);
+    PaintCtx_FillPolygon(Ctx, StarRight, 5, BLACK, FILL_RULE_NONZERO);
+    PaintCtx_DrawPolyline(Ctx, Zigzag, 6, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    PaintCtx_DrawPolyline(Ctx, Zigzag, 6, BLACK, DOT_PIXEL_6X6, LINE_STYLE_SOLID);
+    PaintCtx_DrawPolygon(Ctx, Shape, 5, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawPolygon(Ctx, Star, 5, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+}
+
+// Everything above, smaller, to draw rotated and mirrored
+static void Scene_Mixed(PAINT *Ctx)
+{
+    static const PAINT_POINT Triangle[] = {
+        {300, 20}, {460, 200}, {260, 160},
+    };
+
+    PaintCtx_DrawRectangle(Ctx, 5, 5, 180, 90, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintCtx_FillRect(Ctx, 20, 20, 61, 70, BLACK);
+    PaintCtx_DrawLine(Ctx, 5, 100, 470, 100, BLACK, DOT_PIXEL_3X3, LINE_STYLE_SOLID);
+    PaintCtx_DrawLine(Ctx, 200, 5, 200, 470, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+    PaintCtx_DrawCircle(Ctx, 100, 200, 70, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintCtx_DrawEllipse(Ctx, 100, 350, 80, 40, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_FillPolygon(Ctx, Triangle, 3, BLACK, FILL_RULE_EVEN_ODD);
+    PaintCtx_DrawString_EN(Ctx, 220, 240, "Rotate", &Font24, BLACK, WHITE);
+    PaintCtx_DrawString_Prop(Ctx, 220, 280, "and mirror", &Font16P, WHITE, BLACK);
+}
+
+static void Scene_Clip(PAINT *Ctx)
+{
+    PaintCtx_PushClip(Ctx, 50, 50, 403, 301);
+    PaintCtx_DrawCircle(Ctx, 60, 60, 100, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawLine(Ctx, 0, 0, 799, 479, BLACK, DOT_PIXEL_5X5, LINE_STYLE_SOLID);
+    PaintCtx_PushClip(Ctx, 300, 200, 700, 400);
+    PaintCtx_FillRect(Ctx, 0, 0, 800, 480, BLACK);
+    PaintCtx_PopClip(Ctx);
+    PaintCtx_DrawString_EN(Ctx, 330, 100, "Clipped text", &Font24, BLACK, WHITE);
+    PaintCtx_PopClip(Ctx);
+    PaintCtx_DrawRectangle(Ctx, 50, 50, 403, 301, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+}
+
+static void Scene_Fonts(PAINT *Ctx)
+{
+    PaintCtx_DrawString_EN(Ctx, 5, 5, "Font8 !\"#$%&'()*+,-./0123456789:;<=>?@ABC", &Font8, BLACK, WHITE);
+    PaintCtx_DrawString_EN(Ctx, 5, 20, "Font12 DEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`", &Font12, BLACK, WHITE);
+    PaintCtx_DrawString_EN(Ctx, 5, 40, "Font16 abcdefghijklmnopqrstuvwxyz{|}~", &Font16, WHITE, BLACK);
+    PaintCtx_DrawString_EN(Ctx, 5, 65, "Font20 The quick brown fox", &Font20, BLACK, WHITE);
+    PaintCtx_DrawString_EN(Ctx, 5, 95, "Font24 jumps over the lazy dog", &Font24, BLACK, WHITE);
+    PaintCtx_DrawString_EN(Ctx, 700, 130, "Off the edge", &Font24, BLACK, WHITE);
+    PaintCtx_DrawNum(Ctx, 5, 130, 1234567890, &Font20, BLACK, WHITE);
+    PaintCtx_DrawString_Scaled(Ctx, 5, 160, "x2 Scaled", &Font16, 2, BLACK, WHITE);
+    PaintCtx_DrawString_Scaled(Ctx, 300, 160, "x3", &Font24, 3, WHITE, BLACK);
+    PaintCtx_DrawString_Prop(Ctx, 5, 260, "Font8P proportional text", &Font8P, BLACK, WHITE);
+    PaintCtx_DrawString_Prop(Ctx, 5, 275, "Font12P proportional text", &Font12P, BLACK, WHITE);
+    PaintCtx_DrawString_Prop(Ctx, 5, 295, "Font16P proportional text", &Font16P, BLACK, WHITE);
+    PaintCtx_DrawString_Prop(Ctx, 5, 320, "Font20P proportional text", &Font20P, WHITE, BLACK);
+    PaintCtx_DrawString_Prop(Ctx, 5, 350, "Font24P proportional Wj|", &Font24P, BLACK, WHITE);
+    PaintCtx_DrawString_CN(Ctx, 5, 390, "\xC4\xE3\xBA\xC3 abc", &Font12CN, BLACK, WHITE);
+    PaintCtx_DrawString_CN(Ctx, 5, 420, "\xE4\xBD\xA0\xE5\xA5\xBD AB", &Font24CN, WHITE, BLACK);
+}
+
+static void Scene_Gray(PAINT *Ctx)
+{
+    static const PAINT_POINT Triangle[] = {
+        {620, 20}, {790, 200}, {600, 160},
+    };
+
+    PaintCtx_FillRect(Ctx, 0, 0, 203, 120, GRAY_BLACK);
+    PaintCtx_FillRect(Ctx, 203, 0, 401, 120, GRAY_DARK);
+    PaintCtx_FillRect(Ctx, 401, 0, 598, 120, GRAY_LIGHT);
+    PaintCtx_DrawCircle(Ctx, 100, 250, 80, GRAY_DARK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawLine(Ctx, 0, 130, 799, 470, GRAY_BLACK, DOT_PIXEL_3X3, LINE_STYLE_SOLID);
+    PaintCtx_FillPolygon(Ctx, Triangle, 3, GRAY_LIGHT, FILL_RULE_EVEN_ODD);
+    PaintCtx_DrawString_EN(Ctx, 250, 150, "4 gray", &Font24, GRAY_BLACK, GRAY_LIGHT);
+    PaintCtx_DrawString_AA(Ctx, 250, 200, "Font8AA anti-aliased text", &Font8AA, GRAY_BLACK, GRAY_WHITE);
+    PaintCtx_DrawString_AA(Ctx, 250, 220, "Font10AA anti-aliased text", &Font10AA, GRAY_BLACK, GRAY_WHITE);
+    PaintCtx_DrawString_AA(Ctx, 250, 240, "Font12AA anti-aliased text", &Font12AA, GRAY_BLACK, GRAY_WHITE);
+    PaintCtx_DrawString_AA(Ctx, 10, 60, "Over gray", &Font12AA, GRAY_WHITE, FONT_BACKGROUND);
+    PaintCtx_DrawString_AA(Ctx, 420, 60, "Over light gray", &Font12AA, GRAY_BLACK, FONT_BACKGROUND);
+}
+
+// A horizontal ramp with a brighter disc, Width x Height source pixels
+static void Dither_Ramp(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UBYTE Scale, DITHER_MODE Mode)
+{
+    static int16_t Errors[DITHER_ERROR_SIZE(IMAGE_WIDTH)];
+    UBYTE Row[200];
+    DITHER Dither;
+    int X, Y;
+
+    DitherCtx_Start(Ctx, &Dither, Xstart, Ystart, 200, 100, Scale, Mode, Errors, sizeof(Errors) / sizeof(Errors[0]));
+    for(Y = 0; Y < 100; Y++) {
+        for(X = 0; X < 200; X++)
+            Row[X] = ((X - 100) * (X - 100) + (Y - 50) * (Y - 50) < 1600)? 255 - X: X * 255 / 199;
+        Dither_Row(&Dither, Row);
+    }
+}
+
+static void Scene_Dither(PAINT *Ctx)
+{
+    Dither_Ramp(Ctx, 0, 0, 1, DITHER_FLOYD_STEINBERG);
+    Dither_Ramp(Ctx, 210, 0, 1, DITHER_ATKINSON);
+    Dither_Ramp(Ctx, 420, 0, 1, DITHER_BAYER);
+    Dither_Ramp(Ctx, 3, 110, 2, DITHER_FLOYD_STEINBERG);
+    Dither_Ramp(Ctx, 410, 110, 3, DITHER_BAYER);
+}
+
+static void Scene_Dither_Gray(PAINT *Ctx)
+{
+    Dither_Ramp(Ctx, 0, 0, 2, DITHER_FLOYD_STEINBERG);
+    Dither_Ramp(Ctx, 400, 0, 2, DITHER_ATKINSON);
+    Dither_Ramp(Ctx, 200, 220, 2, DITHER_BAYER);
+}
+
+// A 64 x 32 tile: a frame, a diagonal and some text
+static void Draw_Tile(UBYTE *Tile)
+{
+    PAINT TileCtx;
+
+    PaintCtx_NewImage(&TileCtx, Tile, 64, 32, ROTATE_0, WHITE);
+    PaintCtx_SetScale(&TileCtx, 2);
+    PaintCtx_Clear(&TileCtx, WHITE);
+    PaintCtx_DrawRectangle(&TileCtx, 0, 0, 64, 32, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    PaintCtx_DrawLine(&TileCtx, 0, 0, 63, 31, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    PaintCtx_DrawString_EN(&TileCtx, 8, 10, "Tile", &Font12, BLACK, WHITE);
+}
+
+static void Scene_Blit(PAINT *Ctx)
+{
+    static UBYTE Tile[64 / 8 * 32];
+    UBYTE Rop;
+
+    Draw_Tile(Tile);
+    PaintCtx_FillRect(Ctx, 0, 200, 800, 260, BLACK);
+    for(Rop = BLIT_COPY; Rop <= BLIT_NOT; Rop++) {
+        PaintCtx_Blit(Ctx, Tile, 64, 32, 10 + Rop * 150, 10, (BLIT_ROP)Rop);
+        PaintCtx_Blit(Ctx, Tile, 64, 32, 13 + Rop * 150, 215, (BLIT_ROP)Rop);
+        PaintCtx_Blit(Ctx, Tile, 64, 32, 77 + Rop * 150, 240, (BLIT_ROP)Rop);
+    }
+    PaintCtx_Blit(Ctx, Tile, 64, 32, 770, 460, BLIT_COPY);
+    PaintCtx_BlitBitmap(Ctx, 100, 300, Tile, 64, 32, 8, BLACK, WHITE, 0);
+    PaintCtx_BlitBitmap(Ctx, 203, 300, Tile, 64, 32, 8, WHITE, BLACK, 1);
+}
+
+static void Scene_Compose(PAINT *Ctx)
+{
+    static UBYTE Back[IMAGE_WIDTH / 8 * IMAGE_HEIGHT];
+    static UBYTE Over[IMAGE_WIDTH / 8 * IMAGE_HEIGHT];
+    PAINT BackCtx, OverCtx;
+    PAINT_LAYER Layers[2];
+
+    PaintCtx_NewImage(&BackCtx, Back, IMAGE_WIDTH, IMAGE_HEIGHT, ROTATE_0, WHITE);
+    PaintCtx_SetScale(&BackCtx, 2);
+    PaintCtx_Clear(&BackCtx, WHITE);
+    PaintCtx_DrawRectangle(&BackCtx, 0, 0, 400, 480, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PaintCtx_DrawCircle(&BackCtx, 600, 240, 150, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+
+    PaintCtx_NewImage(&OverCtx, Over, IMAGE_WIDTH, IMAGE_HEIGHT, ROTATE_0, WHITE);
+    PaintCtx_SetScale(&OverCtx, 2);
+    PaintCtx_Clear(&OverCtx, BLACK);
+    PaintCtx_DrawString_EN(&OverCtx, 250, 220, "Overlay", &Font24, WHITE, BLACK);
+    PaintCtx_DrawRectangle(&OverCtx, 100, 100, 700, 380, WHITE, DOT_PIXEL_4X4, DRAW_FILL_EMPTY);
+
+    Layers[0] = (PAINT_LAYER){&BackCtx, BLIT_COPY};
+    Layers[1] = (PAINT_LAYER){&OverCtx, BLIT_XOR};
+    PaintCtx_Compose(Ctx, Layers, 2);
+}
+
+// The portrait frame turned into the panel memory, see Check_RotateImage
+static void Draw_Portrait(UBYTE *Portrait)
+{
+    PAINT PortraitCtx;
+
+    PaintCtx_NewImage(&PortraitCtx, Portrait, IMAGE_HEIGHT, IMAGE_WIDTH, ROTATE_0, WHITE);
+    PaintCtx_SetScale(&PortraitCtx, 2);
+    PaintCtx_Clear(&PortraitCtx, WHITE);
+    Scene_Mixed(&PortraitCtx);
+    PaintCtx_DrawString_EN(&PortraitCtx, 10, 700, "Portrait", &Font24, BLACK, WHITE);
+}
+
+static void Scene_Rotate_Image_90(PAINT *Ctx)
+{
+    Draw_Portrait(Source);
+    Paint_RotateImage(Source, IMAGE_HEIGHT, IMAGE_WIDTH, Ctx->Image, ROTATE_90);
+}
+
+static void Scene_Rotate_Image_180(PAINT *Ctx)
+{
+    PAINT SourceCtx;
+
+    PaintCtx_NewImage(&SourceCtx, Source, IMAGE_WIDTH, IMAGE_HEIGHT, ROTATE_0, WHITE);
+    PaintCtx_SetScale(&SourceCtx, 2);
+    PaintCtx_Clear(&SourceCtx, WHITE);
+    Scene_Mixed(&SourceCtx);
+    Paint_RotateImage(Source, IMAGE_WIDTH, IMAGE_HEIGHT, Ctx->Image, ROTATE_180);
+}
+
+static void Scene_Rotate_Image_270(PAINT *Ctx)
+{
+    Draw_Portrait(Source);
+    Paint_RotateImage(Source, IMAGE_HEIGHT, IMAGE_WIDTH, Ctx->Image, ROTATE_270);
+}
+
+static void Scene_QR(PAINT *Ctx)
+{
+    static const char Url[] = "https://github.com/DevOats/PicoPaper";
+    QR_WORKSPACE Work;
+    char Long[272];
+    UWORD i;
+
+    for(i = 0; i < sizeof(Long); i++)
+        Long[i] = 'A' + i % 26;
+    BarcodeCtx_DrawQR(Ctx, &Work, 0, 0, (const UBYTE *)"1", 1, QR_ECC_L, 4, BLACK, WHITE);
+    BarcodeCtx_DrawQR(Ctx, &Work, 120, 0, (const UBYTE *)Url, sizeof(Url) - 1, QR_ECC_M, 3, BLACK, WHITE);
+    BarcodeCtx_DrawQR(Ctx, &Work, 260, 0, (const UBYTE *)Url, sizeof(Url) - 1, QR_ECC_Q, 2, BLACK, WHITE);
+    BarcodeCtx_DrawQR(Ctx, &Work, 370, 0, (const UBYTE *)Url, sizeof(Url) - 1, QR_ECC_H, 2, WHITE, BLACK);
+    BarcodeCtx_DrawQR(Ctx, &Work, 0, 180, (const UBYTE *)Long, 119, QR_ECC_H, 3, BLACK, WHITE);
+    BarcodeCtx_DrawQR(Ctx, &Work, 220, 180, (const UBYTE *)Long, 271, QR_ECC_L, 3, BLACK, WHITE);
+}
+
+static void Scene_Code128(PAINT *Ctx)
+{
+    static const char Mixed[] = "PicoPaper-2026\tv1.0 1234567890";
+
+    BarcodeCtx_DrawCode128(Ctx, 0, 10, (const UBYTE *)"HELLO world", 11, 2, 60, BLACK, WHITE);
+    BarcodeCtx_DrawCode128(Ctx, 0, 90, (const UBYTE *)"0123456789012345", 16, 3, 60, BLACK, WHITE);
+    BarcodeCtx_DrawCode128(Ctx, 0, 170, (const UBYTE *)Mixed, sizeof(Mixed) - 1, 1, 80, BLACK, WHITE);
+    BarcodeCtx_DrawCode128(Ctx, 0, 270, (const UBYTE *)"\x01\x02" "ABC\x7F", 6, 2, 40, WHITE, BLACK);
+}
+
+/**
+ * A scene and its recorded checksum
+**/
+typedef struct {
+    const char *Name;
+    void (*Draw)(PAINT *Ctx);
+    UBYTE Scale;
+    UWORD Rotate;
+    UBYTE Mirror;
+    UDOUBLE Crc;
+} GOLDEN;
+
+static const GOLDEN Goldens[] = {
+    {"rectangles",          Scene_Rectangles,       2, ROTATE_0,   MIRROR_NONE,       0x6FFC830D},
+    {"lines",               Scene_Lines,            2, ROTATE_0,   MIRROR_NONE,       0x3353DB4D},
+    {"curves",              Scene_Curves,           2, ROTATE_0,   MIRROR_NONE,       0x9B86D4D2},
+    {"polygons",            Scene_Polygons,         2, ROTATE_0,   MIRROR_NONE,       0x46AAE1BD},
+    {"mixed",               Scene_Mixed,            2, ROTATE_0,   MIRROR_NONE,       0x3849B0D0},
+    {"mixed-90",            Scene_Mixed,            2, ROTATE_90,  MIRROR_NONE,       0xDD48E4D6},
+    {"mixed-180",           Scene_Mixed,            2, ROTATE_180, MIRROR_NONE,       0x69FB8FA9},
+    {"mixed-270",           Scene_Mixed,            2, ROTATE_270, MIRROR_NONE,       0xBFB65E61},
+    {"mixed-mirror-h",      Scene_Mixed,            2, ROTATE_0,   MIRROR_HORIZONTAL, 0xCE30FF84},
+    {"mixed-90-mirror-v",   Scene_Mixed,            2, ROTATE_90,  MIRROR_VERTICAL,   0x12C2CA83},
+    {"mixed-gray-270",      Scene_Mixed,            4, ROTATE_270, MIRROR_ORIGIN,     0x43788D46},
+    {"clip",                Scene_Clip,             2, ROTATE_0,   MIRROR_NONE,       0x8D2B6328},
+    {"fonts",               Scene_Fonts,            2, ROTATE_0,   MIRROR_NONE,       0x7CA584CC},
+    {"gray",                Scene_Gray,             4, ROTATE_0,   MIRROR_NONE,       0xF130A6EC},
+    {"dither",              Scene_Dither,           2, ROTATE_0,   MIRROR_NONE,       0x80AA0C7C},
+    {"dither-gray",         Scene_Dither_Gray,      4, ROTATE_0,   MIRROR_NONE,       0x8C0DF588},
+    {"blit",                Scene_Blit,             2, ROTATE_0,   MIRROR_NONE,       0x1080E027},
+    {"compose",             Scene_Compose,          2, ROTATE_0,   MIRROR_NONE,       0x1B05A4CD},
+    {"rotate-image-90",     Scene_Rotate_Image_90,  2, ROTATE_0,   MIRROR_NONE,       0x6943A020},
+    {"rotate-image-180",    Scene_Rotate_Image_180, 2, ROTATE_0,   MIRROR_NONE,       0x69FB8FA9},
+    {"rotate-image-270",    Scene_Rotate_Image_270, 2, ROTATE_0,   MIRROR_NONE,       0xEC9FF24B},
+    {"qr",                  Scene_QR,               2, ROTATE_0,   MIRROR_NONE,       0x6AC94166},
+    {"code128",             Scene_Code128,          2, ROTATE_0,   MIRROR_NONE,       0x65465E71},
+};
+
+/******************************************************************************
+function:	Clear the image and set up the context of a scene
+******************************************************************************/
+static void Begin(PAINT *Ctx, UBYTE Scale, UWORD Rotate, UBYTE Mirror)
+{
+    memset(Image, 0, sizeof(Image));
+    PaintCtx_NewImage(Ctx, Image, IMAGE_WIDTH, IMAGE_HEIGHT, Rotate, WHITE);
+    PaintCtx_SetScale(Ctx, Scale);
+    PaintCtx_SetRotate(Ctx, Rotate);
+    PaintCtx_SetMirroring(Ctx, Mirror);
+    PaintCtx_Clear(Ctx, (Scale == 4)? GRAY_WHITE: WHITE);
+}
+
+static UDOUBLE Image_Size(const PAINT *Ctx)
+{
+    return (UDOUBLE)Ctx->WidthByte * Ctx->HeightByte;
+}
+
+static int Save_PGM(const PAINT *Ctx, const char *Dir, const char *Name)
+{
+    char Path[256];
+    FILE *File;
+    UWORD X, Y;
+    UBYTE Level;
+
+    snprintf(Path, sizeof(Path), "%s/%s.pgm", Dir, Name);
+    File = fopen(Path, "wb");
+    if(File == NULL)
+        return 1;
+    fprintf(File, "P5\n%d %d\n255\n", Ctx->WidthMemory, Ctx->HeightMemory);
+    for(Y = 0; Y < Ctx->HeightMemory; Y++) {
+        for(X = 0; X < Ctx->WidthMemory; X++) {
+            if(Ctx->Scale == 4)
+                Level = ((Ctx->Image[Y * Ctx->WidthByte + X / 4] >> (6 - 2 * (X % 4))) & 0x03) * 85;
+            else
+                Level = (Ctx->Image[Y * Ctx->WidthByte + X / 8] & (0x80 >> (X % 8)))? 255: 0;
+            fputc(Level, File);
+        }
+    }
+    fclose(File);
+    return 0;
+}
+
+/******************************************************************************
+function:	Checks against a pixel by pixel reference
+info:
+    Each returns 0 when the fast path draws what the reference draws
+******************************************************************************/
+// Paint_FillRect against Paint_SetPixel, at every alignment of both edges
+static UBYTE Check_FillRect(void)
+{
+    PAINT Ctx, RefCtx;
+    UWORD Xstart, Xend, X, Y;
+
+    for(Xstart = 0; Xstart < 24; Xstart++) {
+        for(Xend = Xstart + 1; Xend < 48; Xend++) {
+            Begin(&Ctx, 2, ROTATE_0, MIRROR_NONE);
+            PaintCtx_FillRect(&Ctx, Xstart, 1, Xend, 3, BLACK);
+            PaintCtx_NewImage(&RefCtx, Reference, IMAGE_WIDTH, IMAGE_HEIGHT, ROTATE_0, WHITE);
+            PaintCtx_SetScale(&RefCtx, 2);
+            PaintCtx_Clear(&RefCtx, WHITE);
+            for(Y = 1; Y < 3; Y++)
+                for(X = Xstart; X < Xend; X++)
+                    PaintCtx_SetPixel(&RefCtx, X, Y, BLACK);
+            if(memcmp(Image, Reference, Image_Size(&Ctx)) != 0)
+                return 1;
+        }
+    }
+    return 0;
+}
+
+// Paint_RotateImage against Paint_SetPixel in a rotated context
+static UBYTE Check_RotateImage(void)
+{
+    static const UWORD Rotates[] = {ROTATE_90, ROTATE_180, ROTATE_270};
+    PAINT RefCtx;
+    UWORD X, Y, Width, Height;
+    UBYTE i;
+
+    Draw_Portrait(Source);
+    for(i = 0; i < 3; i++) {
+        Width = (Rotates[i] == ROTATE_180)? IMAGE_WIDTH: IMAGE_HEIGHT;
+        Height = (Rotates[i] == ROTATE_180)? IMAGE_HEIGHT: IMAGE_WIDTH;
+        Paint_RotateImage(Source, Width, Height, Image, Rotates[i]);
+        PaintCtx_NewImage(&RefCtx, Reference, IMAGE_WIDTH, IMAGE_HEIGHT, Rotates[i], WHITE);
+        PaintCtx_SetScale(&RefCtx, 2);
+        PaintCtx_SetRotate(&RefCtx, Rotates[i]);
+        for(Y = 0; Y < Height; Y++)
+            for(X = 0; X < Width; X++)
+                PaintCtx_SetPixel(&RefCtx, X, Y, (Source[Y * (Width / 8) + X / 8] & (0x80 >> (X % 8)))? WHITE: BLACK);
+        if(memcmp(Image, Reference, IMAGE_WIDTH / 8 * IMAGE_HEIGHT) != 0)
+            return 1;
+    }
+    return 0;
+}
+
+// A Chinese string in GB2312 and in UTF-8 draws the same glyphs
+static UBYTE Check_Chinese_Encodings(void)
+{
+    PAINT Ctx;
+
+    Begin(&Ctx, 2, ROTATE_0, MIRROR_NONE);
+    PaintCtx_DrawString_CN(&Ctx, 10, 10, "\xC4\xE3\xBA\xC3 AB", &Font24CN, BLACK, WHITE);
+    memcpy(Reference, Image, Image_Size(&Ctx));
+    Begin(&Ctx, 2, ROTATE_0, MIRROR_NONE);
+    PaintCtx_DrawString_CN(&Ctx, 10, 10, "\xE4\xBD\xA0\xE5\xA5\xBD AB", &Font24CN, BLACK, WHITE);
+    return memcmp(Image, Reference, Image_Size(&Ctx)) != 0;
+}
+
+// Paint_DrawBitMap marks the whole image memory dirty, in memory pixels at every scale
+static UBYTE Check_DrawBitMap_Dirty(void)
+{
+    static const UBYTE Scales[] = {2, 4};
+    PAINT Ctx;
+    PAINT_RECT Dirty;
+    UBYTE i;
+
+    for(i = 0; i < sizeof(Scales); i++) {
+        Begin(&Ctx, Scales[i], ROTATE_0, MIRROR_NONE);
+        memset(Source, 0xFF, Image_Size(&Ctx));
+        PaintCtx_ResetDirty(&Ctx);
+        PaintCtx_DrawBitMap(&Ctx, Source);
+        if(!PaintCtx_GetDirty(&Ctx, &Dirty) || Dirty.Xstart != 0 || Dirty.Ystart != 0 ||
+           Dirty.Xend != IMAGE_WIDTH || Dirty.Yend != IMAGE_HEIGHT)
+            return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct {
+        const char *Name;
+        UBYTE (*Check)(void);
+    } Checks[] = {
+        {"fillrect-pixels",     Check_FillRect},
+        {"rotate-image-pixels", Check_RotateImage},
+        {"chinese-encodings",   Check_Chinese_Encodings},
+        {"bitmap-dirty",        Check_DrawBitMap_Dirty},
+    };
+    const char *OutDir = NULL;
+    int Failed = 0;
+    PAINT Ctx;
+    UDOUBLE Crc;
+    UBYTE i;
+
+    if(argc == 3 && strcmp(argv[1], "-o") == 0) {
+        OutDir = argv[2];
+    } else if(argc != 1) {
+        fprintf(stderr, "usage: %s [-o DIR]\n", argv[0]);
+        return 2;
+    }
+
+    for(i = 0; i < sizeof(Goldens) / sizeof(Goldens[0]); i++) {
+        const GOLDEN *g = &Goldens[i];
+
+        Begin(&Ctx, g->Scale, g->Rotate, g->Mirror);
+        g->Draw(&Ctx);
+        Crc = Crc32(Image, Image_Size(&Ctx));
+        if(OutDir && Save_PGM(&Ctx, OutDir, g->Name) != 0) {
+            fprintf(stderr, "cannot write %s/%s.pgm\n", OutDir, g->Name);
+            return 2;
+        }
+        printf("%-24s %08lX  %s\n", g->Name, (unsigned long)Crc, (Crc == g->Crc)? "ok": "FAIL");
+        Failed += (Crc != g->Crc);
+    }
+
+    for(i = 0; i < sizeof(Checks) / sizeof(Checks[0]); i++) {
+        UBYTE Bad = Checks[i].Check();
+        printf("%-24s %8s  %s\n", Checks[i].Name, "", Bad? "FAIL": "ok");
+        Failed += Bad;
+    }
+    return Failed? 1: 0;
+}
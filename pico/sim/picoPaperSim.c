@@ -0,0 +1,478 @@
+/*****************************************************************************
+* | File      	:   picoPaperSim.c
+* | Function    :   Performance report of the e-Paper driver on the host
+* | Info        :
+*   Runs the driver paths that picoDisplay uses against the simulated panels
+*   and prints the counters of each. "shown" compares the image that the
+*   simulated panel shows with the image that was sent, and the exit code
+*   is 1 when one of them differs. The refresh time of the OTP waveforms
+*   is an input of the simulation, not a measurement, see Sim_Refresh_ms.
+*
+*   picoPaperSim [-o DIR]     -o writes the shown image of every run as PGM
+******************************************************************************/
+#include "DEV_Sim.h"
+#include "EPD_7in5_V2.h"
+#include "GUI_Paint.h"
+#include "GUI_Dither.h"
+#include "GUI_Barcode.h"
+#include "displayList.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define IMAGE_SIZE      (EPD_7IN5_V2_WIDTH / 8 * EPD_7IN5_V2_HEIGHT)
+
+static UBYTE Image[IMAGE_SIZE];
+static UBYTE Image4Gray[IMAGE_SIZE * 2];
+static const char *OutDir;
+static int Failed;
+
+/******************************************************************************
+function:	Test pictures, text and shapes over the whole panel
+******************************************************************************/
+static void Draw_Images(void)
+{
+    Paint_NewImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_Clear(WHITE);
+    Paint_DrawString_EN(10, 10, "PicoPaper host simulation", &Font24, BLACK, WHITE);
+    Paint_DrawRectangle(10, 60, 390, 470, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawRectangle(410, 60, 790, 470, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawCircle(200, 265, 150, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    Paint_DrawLine(10, 60, 390, 470, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+
+    Paint_NewImage(Image4Gray, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+    Paint_SelectImage(Image4Gray, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_SetScale(4);
+    Paint_Clear(WHITE);
+    Paint_DrawRectangle(0, 120, 200, 360, GRAY_BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawRectangle(200, 120, 400, 360, GRAY_DARK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawRectangle(400, 120, 600, 360, GRAY_LIGHT, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawString_EN(10, 10, "4 gray", &Font24, GRAY_BLACK, GRAY_WHITE);
+    Paint_DrawString_AA(10, 50, "Anti-aliased text over white", &Font12AA, GRAY_BLACK, GRAY_WHITE);
+    Paint_DrawString_AA(410, 240, "and over gray", &Font12AA, GRAY_BLACK, FONT_BACKGROUND);
+    Paint_SetScale(2);
+}
+
+/******************************************************************************
+function:	Does the panel show the image
+parameter:
+    Panel : Panel index
+    Gray  : The image is Image4Gray, else Image
+******************************************************************************/
+static UBYTE Shown(UBYTE Panel, UBYTE Gray)
+{
+    const DEV_SIM_PANEL *p = DEV_Sim_Panel(Panel);
+    UWORD X, Y;
+    UBYTE Expected;
+
+    for(Y = 0; Y < EPD_7IN5_V2_HEIGHT; Y++) {
+        for(X = 0; X < EPD_7IN5_V2_WIDTH; X++) {
+            if(Gray)
+                Expected = (Image4Gray[(X + Y * EPD_7IN5_V2_WIDTH) / 4] >> (6 - 2 * (X % 4))) & 0x03;
+            else
+                Expected = (Image[(X + Y * EPD_7IN5_V2_WIDTH) / 8] & (0x80 >> (X % 8)))? 3: 0;
+            if(p->Screen[Y][X] != Expected)
+                return 0;
+        }
+    }
+    return 1;
+}
+
+static void Report(const char *Name, UBYTE Gray)
+{
+    char Path[256];
+    UBYTE Ok = Shown(EPD_Panel_Active, Gray);
+
+    printf("%-26s %9lu %7lu %7lu %8lu %5lu %9.1f %9.1f  %s\n", Name,
+        (unsigned long)DEV_Sim_Counters.SpiBytes,
+        (unsigned long)DEV_Sim_Counters.SpiCalls,
+        (unsigned long)DEV_Sim_Counters.CsToggles,
+        (unsigned long)DEV_Sim_Counters.GpioWrites,
+        (unsigned long)DEV_Sim_Counters.Refreshes,
+        DEV_Sim_Counters.Spi_ns / 1e6,
+        DEV_Sim_Counters.Time_ns / 1e6,
+        Ok? "ok": "DIFF");
+    Failed += !Ok;
+
+    if(OutDir) {
+        snprintf(Path, sizeof(Path), "%s/%s.pgm", OutDir, Name);
+        DEV_Sim_Save_PGM(EPD_Panel_Active, Path);
+    }
+}
+
+/******************************************************************************
+function:	One update of the selected panel, the way picoDisplay does it
+******************************************************************************/
+static void Run_Mode(const char *Name, EPD_7IN5_V2_MODE Mode)
+{
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(Mode);
+    EPD_7IN5_V2_ReadTemperature();
+    if(Mode == EPD_7IN5_V2_MODE_PART)
+        EPD_7IN5_V2_Display_Part(Image, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    else if(Mode == EPD_7IN5_V2_MODE_4GRAY)
+        EPD_7IN5_V2_Display_4Gray(Image4Gray);
+    else
+        EPD_7IN5_V2_Display(Image);
+    EPD_7IN5_V2_Sleep();
+    Report(Name, Mode == EPD_7IN5_V2_MODE_4GRAY);
+}
+
+/******************************************************************************
+function:	A clock that changed since the last update, refreshed through the
+            dirty region of Paint
+******************************************************************************/
+static void Run_Dirty(void)
+{
+    PAINT_RECT Dirty;
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_ClearWindows(600, 20, 780, 44, WHITE);
+    Paint_DrawString_EN(620, 20, "12:34", &Font24, BLACK, WHITE);
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-dirty", 0);
+}
+
+/******************************************************************************
+function:	A dashboard sent as a display list instead of a frame
+******************************************************************************/
+static void Run_Display_List(void)
+{
+    // Frame, title, a gauge and a reading, coordinates little endian
+    static const UBYTE List[] = {
+        DL_OP_PUSH_CLIP, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0xE0, 0x01,
+        DL_OP_ROUNDED_RECT, 0x14, 0x00, 0x32, 0x00, 0x04, 0x01, 0xB8, 0x00, 0x0C, 0x00, 0x00, 0x02, 0x00,
+        DL_OP_TEXT, 0x28, 0x00, 0x3C, 0x00, 0x04, 0x00, 0xFF, 11, 'O', 'u', 't', 's', 'i', 'd', 'e', ' ', 'a', 'i', 'r',
+        DL_OP_CIRCLE, 0x8C, 0x00, 0x90, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x00,
+        DL_OP_NUMBER, 0xB4, 0x00, 0x82, 0x00, 0x04, 0x00, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF,
+        DL_OP_LINE, 0x28, 0x00, 0xA0, 0x00, 0xE0, 0x01, 0xA0, 0x00, 0x00, 0x01, 0x01,
+        DL_OP_POP_CLIP,
+    };
+    PAINT_RECT Dirty;
+    const char *Error;
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Error = displayList_render(&Paint, List, sizeof(List));
+    if(Error) {
+        printf("display list: %s\n", Error);
+        return;
+    }
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-display-list", 0);
+}
+
+/******************************************************************************
+function:	A grayscale photo at half resolution, dithered on the device into a
+            window and refreshed through the dirty region
+******************************************************************************/
+static void Run_Dither(void)
+{
+    static int16_t Errors[DITHER_ERROR_SIZE(EPD_7IN5_V2_WIDTH)];
+    UBYTE Row[160];
+    DITHER Dither;
+    PAINT_RECT Dirty;
+    UWORD X, Y;
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Dither_Start(&Dither, 440, 120, 160, 100, 2, DITHER_FLOYD_STEINBERG, Errors, sizeof(Errors) / sizeof(Errors[0]));
+    for(Y = 0; Y < 100; Y++) {
+        // A horizontal ramp with a brighter disc in the middle
+        for(X = 0; X < 160; X++)
+            Row[X] = ((X - 80) * (X - 80) + (Y - 50) * (Y - 50) < 1600)? 255 - X: X * 255 / 159;
+        Dither_Row(&Dither, Row);
+    }
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-dither", 0);
+}
+
+/******************************************************************************
+function:	A button drawn once into its own image and copied into the frame
+            three times, as a cached widget is
+******************************************************************************/
+static void Run_Offscreen(void)
+{
+    static UBYTE Tile[120 / 8 * 48];
+    PAINT Button;
+    PAINT_RECT Dirty;
+    UBYTE i;
+
+    PaintCtx_NewImage(&Button, Tile, 120, 48, 0, WHITE);
+    PaintCtx_Clear(&Button, WHITE);
+    PaintCtx_DrawRoundedRectangle(&Button, 1, 1, 120, 48, 10, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    PaintCtx_DrawString_Prop(&Button, 20, 16, "Button", &Font16P, BLACK, WHITE);
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    for(i = 0; i < 3; i++)
+        Paint_Blit(Tile, 120, 48, 20 + i * 125, 410, BLIT_AND);
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-offscreen", 0);
+}
+
+/******************************************************************************
+function:	A dashboard kept as a background layer drawn once and an overlay
+            with the reading. The reading changes and the layers are
+            composed again, the refresh only sends what the reading changed
+******************************************************************************/
+static void Run_Layers(void)
+{
+    static UBYTE BackgroundImage[IMAGE_SIZE];
+    static UBYTE OverlayImage[IMAGE_SIZE];
+    PAINT Background, Overlay;
+    PAINT_LAYER Layers[2] = {{&Background, BLIT_COPY}, {&Overlay, BLIT_AND}};
+    PAINT_RECT Dirty;
+
+    PaintCtx_NewImage(&Background, BackgroundImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+    PaintCtx_Clear(&Background, WHITE);
+    PaintCtx_DrawRoundedRectangle(&Background, 20, 20, 780, 460, 16, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawString_Prop(&Background, 60, 60, "Living room", &Font24P, BLACK, WHITE);
+    PaintCtx_DrawCircle(&Background, 400, 280, 120, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+
+    PaintCtx_NewImage(&Overlay, OverlayImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+    PaintCtx_Clear(&Overlay, WHITE);
+    PaintCtx_DrawString_Scaled(&Overlay, 340, 260, "21.5", &Font16, 3, BLACK, WHITE);
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_Compose(Layers, 2);
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_FAST);
+    EPD_7IN5_V2_Display(Image);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+
+    PaintCtx_Clear(&Overlay, WHITE);
+    PaintCtx_DrawString_Scaled(&Overlay, 340, 260, "21.6", &Font16, 3, BLACK, WHITE);
+    Paint_Compose(Layers, 2);
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-layers", 0);
+}
+
+/******************************************************************************
+function:	A panel mounted in portrait. The screen is drawn upright in a
+            480 x 800 image with no rotation and turned into the layout of
+            the panel by Paint_RotateImage. The rotated frame is composed
+            into the image, so after a change to the upright image the
+            refresh only sends what it changed
+******************************************************************************/
+static void Run_Rotate(void)
+{
+    static UBYTE PortraitImage[IMAGE_SIZE];
+    static UBYTE RotatedImage[IMAGE_SIZE];
+    PAINT Portrait, Rotated;
+    PAINT_LAYER Layer = {&Rotated, BLIT_COPY};
+    PAINT_RECT Dirty;
+
+    PaintCtx_NewImage(&Portrait, PortraitImage, EPD_7IN5_V2_HEIGHT, EPD_7IN5_V2_WIDTH, 0, WHITE);
+    PaintCtx_Clear(&Portrait, WHITE);
+    PaintCtx_DrawRoundedRectangle(&Portrait, 20, 20, 460, 780, 16, BLACK, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    PaintCtx_DrawString_Prop(&Portrait, 50, 50, "Meeting room 2", &Font24P, BLACK, WHITE);
+    PaintCtx_DrawString_Scaled(&Portrait, 50, 300, "Free", &Font16, 4, BLACK, WHITE);
+    PaintCtx_NewImage(&Rotated, RotatedImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_RotateImage(PortraitImage, EPD_7IN5_V2_HEIGHT, EPD_7IN5_V2_WIDTH, RotatedImage, ROTATE_90);
+    Paint_Compose(&Layer, 1);
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_FAST);
+    EPD_7IN5_V2_Display(Image);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+
+    PaintCtx_DrawString_Scaled(&Portrait, 50, 300, "Busy", &Font16, 4, BLACK, WHITE);
+    Paint_RotateImage(PortraitImage, EPD_7IN5_V2_HEIGHT, EPD_7IN5_V2_WIDTH, RotatedImage, ROTATE_90);
+    Paint_Compose(&Layer, 1);
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-rotated", 0);
+}
+
+/******************************************************************************
+function:	Build a display list with the QR code and the barcode of an item
+parameter:
+    List : Room for the list
+    Url  : Payload of the QR code
+    Code : Payload of the barcode
+******************************************************************************/
+static UWORD Barcode_List(UBYTE *List, const char *Url, const char *Code)
+{
+    UWORD Length = 0, Size;
+
+    // QR code at (560, 40), modules of 4 pixels, level M
+    Size = strlen(Url);
+    List[Length++] = DL_OP_QR;
+    List[Length++] = 0x30; List[Length++] = 0x02;
+    List[Length++] = 0x28; List[Length++] = 0x00;
+    List[Length++] = 4;
+    List[Length++] = QR_ECC_M;
+    List[Length++] = BLACK; List[Length++] = WHITE;
+    List[Length++] = Size; List[Length++] = Size >> 8;
+    memcpy(List + Length, Url, Size);
+    Length += Size;
+
+    // Code128 at (500, 240), modules of 2 pixels, bars 60 pixels high
+    Size = strlen(Code);
+    List[Length++] = DL_OP_CODE128;
+    List[Length++] = 0xF4; List[Length++] = 0x01;
+    List[Length++] = 0xF0; List[Length++] = 0x00;
+    List[Length++] = 2;
+    List[Length++] = 0x3C; List[Length++] = 0x00;
+    List[Length++] = BLACK; List[Length++] = WHITE;
+    List[Length++] = Size;
+    memcpy(List + Length, Code, Size);
+    return Length + Size;
+}
+
+/******************************************************************************
+function:	A shelf label with the QR code and the barcode of an item, made
+            on the device from display lists of a few dozen bytes. The
+            item changes and the refresh only sends the two symbols
+******************************************************************************/
+static void Run_Barcode(void)
+{
+    UBYTE List[128];
+    UWORD Length;
+    PAINT_RECT Dirty;
+    const char *Error;
+
+    Paint_SelectImage(Image, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    Paint_Clear(WHITE);
+    Paint_DrawString_Prop(40, 40, "Shelf 12", &Font24P, BLACK, WHITE);
+    Length = Barcode_List(List, "https://example.com/item/1042", "ITEM-1042");
+    Error = displayList_render(&Paint, List, Length);
+    if(Error) {
+        printf("barcode list: %s\n", Error);
+        return;
+    }
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_FAST);
+    EPD_7IN5_V2_Display(Image);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+
+    Length = Barcode_List(List, "https://example.com/item/1043", "ITEM-1043");
+    Error = displayList_render(&Paint, List, Length);
+    if(Error) {
+        printf("barcode list: %s\n", Error);
+        return;
+    }
+    Paint_GetDirty(&Dirty);
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Mode(EPD_7IN5_V2_MODE_PART);
+    EPD_7IN5_V2_ReadTemperature();
+    EPD_7IN5_V2_Display_Window(Image, Dirty.Xstart, Dirty.Ystart, Dirty.Xend, Dirty.Yend);
+    EPD_7IN5_V2_Sleep();
+    Paint_ResetDirty();
+    Report("partial-barcode", 0);
+}
+
+static void Run_Lut(const EPD_7IN5_V2_LUT *Lut)
+{
+    char Name[64];
+
+    DEV_Sim_Reset_Counters();
+    EPD_7IN5_V2_Init_Lut(Lut);
+    EPD_7IN5_V2_Display(Image);
+    EPD_7IN5_V2_Sleep();
+    snprintf(Name, sizeof(Name), "lut-%s", Lut->Name);
+    Report(Name, 0);
+}
+
+/******************************************************************************
+function:	All panels refreshing at the same time
+******************************************************************************/
+static void Run_All_Panels(void)
+{
+    char Name[32];
+    UBYTE i;
+
+    DEV_Sim_Reset_Counters();
+    for(i = 0; i < EPD_Panel_Count; i++) {
+        DEV_Select_Panel(i);
+        EPD_7IN5_V2_Init();
+        EPD_7IN5_V2_Display_Start(Image);
+    }
+    EPD_7IN5_V2_WaitUntilIdle_All((1 << EPD_Panel_Count) - 1);
+    for(i = 0; i < EPD_Panel_Count; i++) {
+        DEV_Select_Panel(i);
+        EPD_7IN5_V2_Sleep();
+    }
+    snprintf(Name, sizeof(Name), "full-x%d-overlapped", EPD_Panel_Count);
+    Report(Name, 0);
+    DEV_Select_Panel(0);
+}
+
+int main(int argc, char *argv[])
+{
+    UBYTE i;
+
+    if(argc == 3 && strcmp(argv[1], "-o") == 0) {
+        OutDir = argv[2];
+    } else if(argc != 1) {
+        fprintf(stderr, "usage: %s [-o DIR]\n", argv[0]);
+        return 2;
+    }
+
+    DEV_Module_Init();
+    Draw_Images();
+
+    printf("%-26s %9s %7s %7s %8s %5s %9s %9s  %s\n", "run",
+        "spi bytes", "calls", "cs", "gpio", "rfsh", "spi ms", "time ms", "shown");
+
+    Run_Mode("full", EPD_7IN5_V2_MODE_FULL);
+    Run_Mode("fast", EPD_7IN5_V2_MODE_FAST);
+    Run_Mode("partial", EPD_7IN5_V2_MODE_PART);
+    Run_Dirty();
+    Run_Display_List();
+    Run_Dither();
+    Run_Offscreen();
+    Run_Layers();
+    Run_Rotate();
+    Run_Barcode();
+    Run_Mode("4gray", EPD_7IN5_V2_MODE_4GRAY);
+    for(i = 0; i < EPD_7IN5_V2_Lut_Count; i++)
+        Run_Lut(&EPD_7IN5_V2_Luts[i]);
+
+    if(EPD_Panel_Count > 1)
+        Run_All_Panels();
+
+    DEV_Module_Exit();
+    return Failed? 1: 0;
+}
@@ -0,0 +1,123 @@
+/*****************************************************************************
+* | File      	:   protocolSim.c
+* | Function    :   Tests of the picoDisplay protocol on the host
+* | Info        :
+*   Feeds command bytes to picoDisplay.c as they come out of the UART
+*   framing and checks what it answers. Payloads that end early or run
+*   on must never leave bytes that are then parsed as commands, so each
+*   check ends with a command and looks for its answer.
+******************************************************************************/
+#include "DEV_Sim.h"
+#include "GUI_Dither.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// picoDisplay.c, not in picoDisplay.h
+void initialize(void);
+void ProcessByteReceived(UBYTE msg);
+void resetUartStateMachine(void);
+
+#define CMD_DEVICE_IDENT    0x01
+#define CMD_IMG_DITHER      0x0C
+
+static char Output[4096];
+
+/******************************************************************************
+function:	Feed bytes to the protocol and keep what it prints in Output
+******************************************************************************/
+static void Send(const UBYTE *Bytes, UWORD Length)
+{
+    FILE *Log = tmpfile();
+    int Saved;
+    size_t Read;
+    UWORD i;
+
+    fflush(stdout);
+    Saved = dup(fileno(stdout));
+    dup2(fileno(Log), fileno(stdout));
+    for(i = 0; i < Length; i++)
+        ProcessByteReceived(Bytes[i]);
+    fflush(stdout);
+    dup2(Saved, fileno(stdout));
+    close(Saved);
+
+    rewind(Log);
+    Read = fread(Output, 1, sizeof(Output) - 1, Log);
+    Output[Read] = '\0';
+    fclose(Log);
+}
+
+// The protocol is idle: an ident command is answered
+static UBYTE Idle(void)
+{
+    static const UBYTE Ident[] = {CMD_DEVICE_IDENT};
+
+    Send(Ident, sizeof(Ident));
+    return strstr(Output, "~ACK#") != NULL && strstr(Output, "PicoPaper") != NULL;
+}
+
+/******************************************************************************
+function:	Checks, each returns 0 when the protocol behaves
+******************************************************************************/
+// A 4 x 1 PackBits image in one literal run
+static UBYTE Check_Dither_PackBits(void)
+{
+    static const UBYTE Header[] = {CMD_IMG_DITHER, 0, 0, 0, 0, 4, 0, 1, 0, 1, DITHER_FLOYD_STEINBERG, 1};
+    static const UBYTE Pixels[] = {3, 0x00, 0x40, 0x80, 0xFF};
+
+    Send(Header, sizeof(Header));
+    Send(Pixels, sizeof(Pixels));
+    return strstr(Output, "~ACK#IMG_DITHERED^") == NULL || !Idle();
+}
+
+// A literal run 2 bytes longer than the image: they are dropped, not run as ident commands
+static UBYTE Check_Dither_PackBits_Overrun(void)
+{
+    static const UBYTE Header[] = {CMD_IMG_DITHER, 0, 0, 0, 0, 4, 0, 1, 0, 1, DITHER_FLOYD_STEINBERG, 1};
+    static const UBYTE Pixels[] = {5, 0x00, 0x40, 0x80, 0xFF, CMD_DEVICE_IDENT, CMD_DEVICE_IDENT};
+
+    Send(Header, sizeof(Header));
+    Send(Pixels, sizeof(Pixels));
+    if(strcmp(Output, "~ERR#PackBits run past the end of the image^\n") != 0)
+        return 1;
+    return !Idle();
+}
+
+// An unknown compression: the payload is dropped until the host resets the protocol
+static UBYTE Check_Dither_Unknown_Compression(void)
+{
+    static const UBYTE Header[] = {CMD_IMG_DITHER, 0, 0, 0, 0, 4, 0, 1, 0, 1, DITHER_FLOYD_STEINBERG, 2};
+    static const UBYTE Pixels[] = {CMD_DEVICE_IDENT, CMD_DEVICE_IDENT};
+
+    Send(Header, sizeof(Header));
+    if(strstr(Output, "~ERR#") == NULL)
+        return 1;
+    Send(Pixels, sizeof(Pixels));
+    if(Output[0] != '\0')
+        return 1;
+    resetUartStateMachine();
+    return !Idle();
+}
+
+int main(void)
+{
+    static const struct {
+        const char *Name;
+        UBYTE (*Check)(void);
+    } Checks[] = {
+        {"dither-packbits",             Check_Dither_PackBits},
+        {"dither-packbits-overrun",     Check_Dither_PackBits_Overrun},
+        {"dither-unknown-compression",  Check_Dither_Unknown_Compression},
+    };
+    int Failed = 0;
+    UBYTE i;
+
+    initialize();
+    for(i = 0; i < sizeof(Checks) / sizeof(Checks[0]); i++) {
+        UBYTE Bad = Checks[i].Check();
+        printf("%-28s %s\n", Checks[i].Name, Bad? "FAIL": "ok");
+        Failed += Bad;
+    }
+    return Failed? 1: 0;
+}